@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Adafruit_NeoPixel.h
+// Host mock of the NeoPixel driver. Every show() is recorded in memory.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+#include "Arduino.h"
+
+#define NEO_RGB ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRB ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_RGBW ((3 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRBW ((3 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_WRGB ((0 << 6) | (1 << 4) | (2 << 2) | (3))
+#define NEO_KHZ800 0x0000
+#define NEO_KHZ400 0x0100
+
+typedef uint16_t neoPixelType;
+
+// Frames sent by show(). Recording is off by default to keep benchmarks fast.
+inline bool nativeRecordFrames = false;
+inline uint32_t nativeShowCount = 0;
+inline std::vector<std::vector<uint8_t>> nativeFrames;
+
+class Adafruit_NeoPixel
+{
+public:
+    Adafruit_NeoPixel(uint16_t n, int16_t pin, neoPixelType type)
+        : numLEDs(n), wOffset((type >> 6) & 3), rOffset((type >> 4) & 3), gOffset((type >> 2) & 3), bOffset(type & 3)
+    {
+        (void)pin;
+        bytesPerPixel = (wOffset == rOffset) ? 3 : 4;
+        pixels.assign(numLEDs * bytesPerPixel, 0);
+    }
+
+    void begin() {}
+    void clear() { std::fill(pixels.begin(), pixels.end(), 0); }
+    bool canShow() { return true; }
+
+    void show()
+    {
+        nativeShowCount++;
+        if (nativeRecordFrames)
+            nativeFrames.push_back(pixels);
+    }
+
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b)
+    {
+        if (n >= numLEDs)
+            return;
+        uint8_t *p = &pixels[n * bytesPerPixel];
+        p[rOffset] = r;
+        p[gOffset] = g;
+        p[bOffset] = b;
+    }
+
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w)
+    {
+        setPixelColor(n, r, g, b);
+        if ((n < numLEDs) && (bytesPerPixel == 4))
+            pixels[n * bytesPerPixel + wOffset] = w;
+    }
+
+    uint8_t *getPixels() { return pixels.data(); }
+    uint16_t numPixels() const { return numLEDs; }
+
+    // Mock only
+    uint8_t getBytesPerPixel() const { return bytesPerPixel; }
+
+private:
+    uint16_t numLEDs;
+    uint8_t bytesPerPixel;
+    uint8_t wOffset, rOffset, gOffset, bOffset;
+    std::vector<uint8_t> pixels;
+};
@@ -0,0 +1,187 @@
+//*****************************************************************************
+// Arduino.cpp
+//*****************************************************************************
+
+#include <chrono>
+#include <cstdarg>
+#include <new>
+#include "Arduino.h"
+#include "EEPROM.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+EEPROMClass EEPROM;
+
+static unsigned long simulatedMillis = 0;
+static uint32_t allocations = 0;
+
+// Count the allocations to find code which uses the heap where it should not.
+void *operator new(size_t size)
+{
+    allocations++;
+    void *memory = malloc(size ? size : 1);
+    if (!memory)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void operator delete(void *memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+    free(memory);
+}
+
+uint32_t nativeAllocations()
+{
+    return allocations;
+}
+
+static uint64_t nowMicros()
+{
+    using namespace std::chrono;
+    static const steady_clock::time_point start = steady_clock::now();
+    return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+unsigned long millis()
+{
+    return nowMicros() / 1000 + simulatedMillis;
+}
+
+unsigned long micros()
+{
+    return nowMicros() + simulatedMillis * 1000;
+}
+
+void delay(unsigned long ms)
+{
+    simulatedMillis += ms;
+}
+
+void nativeAdvanceMillis(unsigned long ms)
+{
+    simulatedMillis += ms;
+}
+
+unsigned long nativeSimulatedMillis()
+{
+    return simulatedMillis;
+}
+
+void yield()
+{
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+long random(long howbig)
+{
+    return howbig ? rand() % howbig : 0;
+}
+
+long random(long howsmall, long howbig)
+{
+    return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall);
+}
+
+void randomSeed(unsigned long seed)
+{
+    srand(seed);
+}
+
+static uint8_t pinState[32] = {};
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    pinState[pin & 31] = val;
+}
+
+int digitalRead(uint8_t pin)
+{
+    return pinState[pin & 31];
+}
+
+int analogRead(uint8_t)
+{
+    return 512;
+}
+
+void attachInterrupt(uint8_t, void (*)(), int)
+{
+}
+
+String::String(int value, unsigned char base) : String((long)value, base) {}
+String::String(unsigned int value, unsigned char base) : String((unsigned long)value, base) {}
+
+String::String(long value, unsigned char base)
+{
+    char buf[34];
+    base == 16 ? snprintf(buf, sizeof(buf), "%lx", value) : snprintf(buf, sizeof(buf), "%ld", value);
+    str = buf;
+}
+
+String::String(unsigned long value, unsigned char base)
+{
+    char buf[34];
+    base == 16 ? snprintf(buf, sizeof(buf), "%lx", value) : snprintf(buf, sizeof(buf), "%lu", value);
+    str = buf;
+}
+
+String::String(float value, unsigned char decimals) : String((double)value, decimals) {}
+
+String::String(double value, unsigned char decimals)
+{
+    char buf[40];
+    snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+    str = buf;
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+    if (from > to)
+        std::swap(from, to);
+    if (from >= str.length())
+        return String();
+    return String(str.substr(from, to - from));
+}
+
+void HardwareSerial::print(long value, int base)
+{
+    print(String(value, (unsigned char)base));
+}
+
+void HardwareSerial::println(long value, int base)
+{
+    println(String(value, (unsigned char)base));
+}
+
+int HardwareSerial::printf(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int result = vprintf(format, args);
+    va_end(args);
+    return result;
+}
+
+uint32_t EspClass::getCycleCount()
+{
+    // Emulate the 80 MHz CCOUNT register.
+    return (uint32_t)(nowMicros() * 80);
+}
+
+uint32_t EspClass::getFreeHeap()
+{
+    return 40 * 1024;
+}
@@ -0,0 +1,147 @@
+//*****************************************************************************
+// Arduino.h
+// Minimal Arduino/ESP8266 core for the host (native) build.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <time.h>
+#include <sys/time.h>
+
+using std::max;
+using std::min;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+#define F(x) (x)
+#define PSTR(x) (x)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(const void *const *)(addr))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x00
+#define OUTPUT 0x01
+#define INPUT_PULLUP 0x02
+#define FALLING 0x02
+#define CHANGE 0x03
+#define A0 17
+#define BIN 2
+#define HEX 16
+#define DEC 10
+
+#define F_CPU 80000000L
+#define ARDUINO_BOARD "native"
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define digitalPinToInterrupt(p) (p)
+#define noInterrupts()
+#define interrupts()
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode);
+
+// Advances the simulated clock used by millis()/micros() without sleeping.
+void nativeAdvanceMillis(unsigned long ms);
+
+// Milliseconds added by delay() and nativeAdvanceMillis() since the start.
+unsigned long nativeSimulatedMillis();
+
+// Heap allocations (operator new) since the start.
+uint32_t nativeAllocations();
+
+class String
+{
+public:
+    String() {}
+    String(const char *s) : str(s ? s : "") {}
+    String(const std::string &s) : str(s) {}
+    String(char c) : str(1, c) {}
+    String(int value, unsigned char base = 10);
+    String(unsigned int value, unsigned char base = 10);
+    String(long value, unsigned char base = 10);
+    String(unsigned long value, unsigned char base = 10);
+    String(float value, unsigned char decimals = 2);
+    String(double value, unsigned char decimals = 2);
+
+    unsigned int length() const { return str.length(); }
+    const char *c_str() const { return str.c_str(); }
+    long toInt() const { return atol(str.c_str()); }
+    String substring(unsigned int from) const { return from < str.length() ? String(str.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const;
+    char operator[](unsigned int index) const { return index < str.length() ? str[index] : 0; }
+    char &operator[](unsigned int index) { return str[index]; }
+
+    String &operator+=(const String &rhs) { str += rhs.str; return *this; }
+    String &operator+=(const char *rhs) { str += rhs; return *this; }
+    String &operator+=(char rhs) { str += rhs; return *this; }
+    bool operator==(const String &rhs) const { return str == rhs.str; }
+    bool operator==(const char *rhs) const { return str == rhs; }
+    bool operator!=(const String &rhs) const { return str != rhs.str; }
+
+    friend String operator+(const String &lhs, const String &rhs) { return String(lhs.str + rhs.str); }
+    friend String operator+(const String &lhs, const char *rhs) { return String(lhs.str + rhs); }
+    friend String operator+(const char *lhs, const String &rhs) { return String(lhs + rhs.str); }
+
+private:
+    std::string str;
+};
+
+class HardwareSerial
+{
+public:
+    void begin(unsigned long) {}
+    void print(const char *s) { fputs(s, stdout); }
+    void print(const String &s) { fputs(s.c_str(), stdout); }
+    void print(char c) { fputc(c, stdout); }
+    void print(long value, int base = DEC);
+    void println() { fputc('\n', stdout); }
+    void println(const char *s) { puts(s); }
+    void println(const String &s) { puts(s.c_str()); }
+    void println(long value, int base = DEC);
+    int printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+extern HardwareSerial Serial;
+
+class EspClass
+{
+public:
+    uint32_t getCycleCount();
+    uint32_t getFreeHeap();
+    uint8_t getCpuFreqMHz() { return 80; }
+    String getResetReason() { return "native"; }
+    void restart() { exit(0); }
+};
+
+extern EspClass ESP;
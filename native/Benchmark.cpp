@@ -0,0 +1,661 @@
+//*****************************************************************************
+// Benchmark.cpp
+// Runs the rendering pipeline on the host. Build with "pio run -e native" and
+// start .pio/build/native/program. Returns 1 if a check fails.
+//*****************************************************************************
+
+#include <chrono>
+#include <set>
+#include "Arduino.h"
+#include "Adafruit_NeoPixel.h"
+#include "Feed.h"
+#include "Font.h"
+#include "FrontCovers.h"
+#include "Helpers.h"
+#include "Input.h"
+#include "LedDriver.h"
+#include "LocalClock.h"
+#include "Profiler.h"
+#include "Renderer.h"
+#include "Scheduler.h"
+#include "Settings.h"
+#include "Transitions.h"
+#include "Words.h"
+
+// Globals of main.cpp used by the code under test
+LedDriver ledDriver;
+Renderer renderer;
+Settings settings;
+LocalClock localClock;
+Feed feed;
+bool alarmTimerSet = false;
+#ifdef DEBUG_PROFILER
+Profiler profiler;
+#endif
+
+static int failures = 0;
+static uint32_t taskRuns[3] = {};
+static Scheduler idleScheduler;
+static Scheduler wakeUpScheduler;
+static uint32_t wakeUpTarget;
+static uint32_t wakeUpSeen;
+static std::vector<uint8_t> gestures;
+
+static void check(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        Serial.printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+template <typename F>
+static void benchmark(const char *name, uint32_t runs, F function)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < runs; i++)
+        function(i);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    Serial.printf("%-24s %8u runs %10.3f us/run\n", name, runs, us / runs);
+}
+
+// Run a transition to its end with loop() called every ms.
+static void runTransition(uint8_t type, uint16_t screenBufferOld[], uint16_t screenBufferNew[], uint8_t color = WHITE,
+                          uint8_t colors[] = nullptr)
+{
+    startTransition(type, screenBufferOld, screenBufferNew, color, 255, colors);
+    while (isTransitionRunning())
+    {
+        nativeAdvanceMillis(1);
+        handleTransition(255);
+    }
+}
+
+// Follow the time second by second from start and compare with localtime().
+static bool clockFollows(time_t start, uint32_t seconds)
+{
+    for (time_t t = start; t < start + (time_t)seconds; t++)
+    {
+        localClock.update(t);
+        const struct tm &tmClock = localClock.getTime();
+        struct tm tmLocal;
+        localtime_r(&t, &tmLocal);
+        if ((tmClock.tm_sec != tmLocal.tm_sec) || (tmClock.tm_min != tmLocal.tm_min) || (tmClock.tm_hour != tmLocal.tm_hour) ||
+            (tmClock.tm_mday != tmLocal.tm_mday) || (tmClock.tm_mon != tmLocal.tm_mon) || (tmClock.tm_year != tmLocal.tm_year) ||
+            (tmClock.tm_wday != tmLocal.tm_wday) || (tmClock.tm_yday != tmLocal.tm_yday) || (tmClock.tm_isdst != tmLocal.tm_isdst))
+        {
+            Serial.printf("LocalClock at %ld: %02d:%02d:%02d, localtime: %02d:%02d:%02d\n", (long)t,
+                          tmClock.tm_hour, tmClock.tm_min, tmClock.tm_sec, tmLocal.tm_hour, tmLocal.tm_min, tmLocal.tm_sec);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void setTimezone(const char *timezone)
+{
+    setenv("TZ", timezone, 1);
+    tzset();
+    localClock.begin(timezone);
+}
+
+// The next step of the feed, without waiting for it.
+static bool stepFeed(uint16_t matrix[])
+{
+    nativeAdvanceMillis(FEED_SPEED);
+    return feed.render(matrix);
+}
+
+static bool frameIsDark(const std::vector<uint8_t> &frame)
+{
+    for (uint8_t value : frame)
+        if (value)
+            return false;
+    return true;
+}
+
+int main()
+{
+    ledDriver.begin();
+    settings.loadFromEEPROM();
+
+    uint16_t matrixOld[10] = {};
+    uint16_t matrix[10] = {};
+
+    benchmark("Renderer::setTime", 100000, [&](uint32_t i) {
+        renderer.clearScreenBuffer(matrix);
+        renderer.setTime((i / 60) % 24, i % 60, matrix);
+        renderer.setCorners(i % 60, matrix);
+    });
+    benchmark("front cover tables", 100000, [&](uint32_t i) {
+        renderer.clearScreenBuffer(matrix);
+        buildFrame(frontCovers[renderer.getFrontCover()], (i / 60) % 24, (i % 60) / 5, matrix);
+        renderer.setCorners(i % 60, matrix);
+    });
+
+    benchmark("writeScreenBuffer", 100000, [&](uint32_t i) {
+        renderer.clearScreenBuffer(matrix);
+        renderer.setTime((i / 60) % 24, i % 60, matrix);
+        writeScreenBuffer(matrix, WHITE, 255);
+    });
+
+    // Frames and cost of a frame of each transition
+    for (uint8_t type = 0; type < TRANSITION_COUNT; type++)
+    {
+        const uint32_t runs = 200;
+        uint32_t frames = ledDriver.getShownFrames() + ledDriver.getSkippedFrames();
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < runs; i++)
+        {
+            renderer.clearScreenBuffer(matrixOld);
+            renderer.setTime(10, i % 60, matrixOld);
+            renderer.clearScreenBuffer(matrix);
+            renderer.setTime(10, (i + 5) % 60, matrix);
+            runTransition(type, matrixOld, matrix, (i % 2) ? RED : WHITE);
+        }
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        frames = ledDriver.getShownFrames() + ledDriver.getSkippedFrames() - frames;
+        Serial.printf("transition %-13s %6.1f frames/run %10.3f us/frame\n", getTransitionName(type), (double)frames / runs, us / frames);
+    }
+
+    // Loop overhead of the clock: localtime() on every loop before, LocalClock now
+    setTimezone(NTP_TIMEZONE);
+    const time_t clockStart = 1774742400; // 29.03.2026 00:00 UTC
+    benchmark("localtime every loop", 100000, [&](uint32_t) {
+        getTime();
+    });
+    benchmark("LocalClock same second", 100000, [&](uint32_t) {
+        localClock.update(clockStart);
+    });
+    benchmark("LocalClock next second", 100000, [&](uint32_t i) {
+        localClock.update(clockStart + 1 + i);
+    });
+    benchmark("LocalClock recalculate", 100000, [&](uint32_t i) {
+        localClock.update(clockStart - 2 * i);
+    });
+
+    const char *quickFox = "The quick brown fox jumps over the lazy dog. 0123456789 The quick brown fox jumps!";
+    benchmark("Feed message, all steps", 10000, [&](uint32_t) {
+        feed.add(quickFox, WHITE, FEED_PRIORITY_NORMAL);
+        stepFeed(matrix);
+        while (stepFeed(matrix))
+            ;
+    });
+    benchmark("Feed::render", 100000, [&](uint32_t) {
+        if (!stepFeed(matrix))
+            feed.add(quickFox, WHITE, FEED_PRIORITY_NORMAL);
+        renderer.clearScreenBuffer(matrix);
+    });
+    benchmark("Font::measure", 100000, [&](uint32_t) {
+        fontBig.measure(quickFox);
+    });
+
+    // Cost of an edge from the interrupt to the handler
+    Input input;
+    benchmark("Input::push and handle", 100000, [&](uint32_t i) {
+        input.push(INPUT_MODE, i & 1);
+        input.handle();
+    });
+
+    // Cost of the scheduler with nothing due
+    Scheduler scheduler;
+    scheduler.addTask("always", []() { taskRuns[0]++; }, TASK_ALWAYS, 0, 0);
+    scheduler.addTask("periodic", []() { taskRuns[1]++; }, TASK_PERIODIC, 40, 1);
+    scheduler.addTask("second", []() { taskRuns[2]++; }, TASK_SECOND, 0, 2);
+    benchmark("Scheduler::run", 100000, [&](uint32_t) {
+        scheduler.run();
+    });
+
+#ifdef DEBUG_PROFILER
+    Serial.print(profiler.getReport());
+#endif
+
+    // Regression checks on the recorded frames
+    nativeRecordFrames = true;
+
+    nativeFrames.clear();
+    renderer.clearScreenBuffer(matrix);
+    writeScreenBuffer(matrix, WHITE, 255);
+    renderer.setTime(12, 0, matrix);
+    writeScreenBuffer(matrix, WHITE, 255);
+    writeScreenBuffer(matrix, WHITE, 255);
+    check(nativeFrames.size() == 2, "unchanged frame is skipped");
+    check(frameIsDark(nativeFrames[0]), "empty screenbuffer is dark");
+    check(!frameIsDark(nativeFrames[1]), "time is shown");
+
+    nativeFrames.clear();
+    renderer.clearScreenBuffer(matrixOld);
+    renderer.setTime(12, 0, matrixOld);
+    renderer.clearScreenBuffer(matrix);
+    renderer.setTime(12, 5, matrix);
+    unsigned long start = millis();
+    runTransition(TRANSITION_FADE, matrixOld, matrix);
+    check(millis() - start >= settings.mySettings.transitionTime, "fade takes the transition time");
+    check(millis() - start < settings.mySettings.transitionTime + 10u, "fade ends in time");
+    check(nativeFrames.size() == TRANSITION_FADE_FRAMES, "fade has a fixed number of frames");
+    std::vector<uint8_t> fadeEnd = nativeFrames.back();
+    writeScreenBuffer(matrix, WHITE, 255);
+    check(nativeFrames.back() == fadeEnd, "fade ends on the new screenbuffer");
+
+    nativeFrames.clear();
+    renderer.clearScreenBuffer(matrixOld);
+    renderer.setTime(12, 0, matrixOld);
+    start = millis();
+    runTransition(TRANSITION_MOVEUP, matrixOld, matrix);
+    check(nativeFrames.size() == 10, "move up shows 10 frames");
+    check(millis() - start >= settings.mySettings.transitionTime, "move up takes the transition time");
+
+    // Every transition ends on the new screenbuffer
+    writeScreenBuffer(matrix, WHITE, 255);
+    std::vector<uint8_t> screenBufferNew = nativeFrames.back();
+    for (uint8_t type = 0; type < TRANSITION_COUNT; type++)
+    {
+        writeScreenBuffer(matrixOld, RED, 255);
+        runTransition(type, matrixOld, matrix);
+        check(nativeFrames.back() == screenBufferNew, getTransitionName(type));
+    }
+
+    // Words painted in a color of their own keep it in every transition
+    uint8_t colorMatrix[NUMPIXELS];
+    uint16_t cornersAndAlarm[10] = {};
+    renderer.setCorners(2, cornersAndAlarm);
+    renderer.setAlarmLed(cornersAndAlarm);
+    renderer.setColorScreenBuffer(cornersAndAlarm, RED, colorMatrix);
+    check((colorMatrix[110] == RED) && (colorMatrix[111] == RED) && (colorMatrix[112] == COLOR_NONE) && (colorMatrix[114] == RED) &&
+              (colorMatrix[0] == COLOR_NONE),
+          "color screenbuffer has the corner and alarm LEDs");
+    uint16_t entryWords[10] = {};
+    renderer.setEntryWords(entryWords);
+    uint8_t entryColors[NUMPIXELS];
+    renderer.setColorScreenBuffer(entryWords, BLUE, entryColors);
+    writeScreenBuffer(entryWords, WHITE, 255);
+    std::vector<uint8_t> entryLeds = nativeFrames.back();
+    writeColorScreenBuffer(entryColors, 255);
+    std::vector<uint8_t> entryFrame = nativeFrames.back();
+    renderer.setColorScreenBuffer(matrix, WHITE, colorMatrix);
+    renderer.paintColorScreenBuffer(entryWords, BLUE, colorMatrix);
+    writeColorScreenBuffer(colorMatrix, 255);
+    std::vector<uint8_t> coloredNew = nativeFrames.back();
+    check(coloredNew != screenBufferNew, "painted words change the frame");
+    for (uint8_t type = 0; type < TRANSITION_COUNT; type++)
+    {
+        writeScreenBuffer(matrixOld, RED, 255);
+        nativeFrames.clear();
+        runTransition(type, matrixOld, matrix, WHITE, entryColors);
+        bool entryKept = true;
+        for (const std::vector<uint8_t> &frame : nativeFrames)
+            for (size_t i = 0; i < frame.size(); i++)
+                entryKept &= !entryLeds[i] || (frame[i] == entryFrame[i]) || (type == TRANSITION_MOVEUP);
+        check(entryKept && (nativeFrames.back() == coloredNew), getTransitionName(type));
+    }
+
+    // A new brightness keeps the colors of the last screenbuffer
+    writeScreenBuffer(matrix, RED, 255);
+    std::vector<uint8_t> redFrame = nativeFrames.back();
+    writeScreenBuffer(matrix, RED, 128);
+    rewriteScreenBuffer(255);
+    check(nativeFrames.back() == redFrame, "screenbuffer is written again in its color");
+    writeColorScreenBuffer(colorMatrix, 128);
+    rewriteScreenBuffer(255);
+    check(nativeFrames.back() == coloredNew, "color screenbuffer is written again in its colors");
+
+#ifdef BUZZER
+    // The alarm LED stays on through a fade and a crossfade
+    for (uint8_t type : {TRANSITION_FADE, TRANSITION_CROSSFADE})
+    {
+        uint16_t alarmOnly[10] = {};
+        renderer.setAlarmLed(alarmOnly);
+        writeScreenBuffer(alarmOnly, RED, 255);
+        nativeFrames.clear();
+        runTransition(type, alarmOnly, alarmOnly);
+        bool alarmShown = true;
+        for (const std::vector<uint8_t> &frame : nativeFrames)
+            alarmShown &= !frameIsDark(frame);
+        check(alarmShown, "alarm LED stays on in a transition");
+    }
+#endif
+
+    // Periodic tasks keep their rate
+    scheduler.resetStats();
+    memset(taskRuns, 0, sizeof(taskRuns));
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        nativeAdvanceMillis(1);
+        scheduler.run();
+    }
+    check(taskRuns[0] == 1000, "TASK_ALWAYS runs every loop");
+    check((taskRuns[1] >= 24) && (taskRuns[1] <= 26), "TASK_PERIODIC runs every 40 ms");
+
+    // The idle governor sleeps until the next task is due
+    idleScheduler.addTask("always", []() { taskRuns[0]++; }, TASK_ALWAYS, 0, 0);
+    idleScheduler.addTask("periodic", []() { taskRuns[1]++; }, TASK_PERIODIC, 40, 1);
+    idleScheduler.setIdleSleep(20);
+    memset(taskRuns, 0, sizeof(taskRuns));
+    unsigned long idleStart = millis();
+    while (millis() - idleStart < 12000)
+        idleScheduler.run();
+    Serial.printf("idle: %u loops in 12 s, duty cycle %u %%\n", taskRuns[0], idleScheduler.getDutyCycle());
+    check((taskRuns[1] >= 299) && (taskRuns[1] <= 301), "TASK_PERIODIC runs every 40 ms when idle");
+    check(taskRuns[0] <= 3 * 301, "idle loop sleeps until the next task is due");
+    check(idleScheduler.getDutyCycle() < 100, "duty cycle below 100 % when idle");
+    idleScheduler.addTask("awake", []() { idleScheduler.stayAwake(); }, TASK_ALWAYS, 0, 0);
+    // The wall clock may tick meanwhile, only delay() would be a sleep.
+    idleStart = nativeSimulatedMillis();
+    for (uint32_t i = 0; i < 100; i++)
+        idleScheduler.run();
+    check(nativeSimulatedMillis() == idleStart, "stayAwake() skips the sleep");
+    wakeUpScheduler.addTask("feed", []() {
+        if (!wakeUpSeen && ((int32_t)(millis() - wakeUpTarget) >= 0))
+            wakeUpSeen = millis();
+        wakeUpScheduler.wakeUpAt(wakeUpTarget);
+    }, TASK_ALWAYS, 0, 0);
+    wakeUpScheduler.setIdleSleep(20);
+    wakeUpTarget = millis() + 7;
+    while (!wakeUpSeen)
+        wakeUpScheduler.run();
+    check(wakeUpSeen - wakeUpTarget <= 1, "wakeUpAt() ends the sleep in time");
+
+    // Local time over DST changes and the new year
+    setTimezone(NTP_TIMEZONE);
+    check(clockFollows(1774742400, 7200), "LocalClock: start of DST");
+    check(clockFollows(1792886400, 7200), "LocalClock: end of DST");
+    check(clockFollows(1798756200, 7200), "LocalClock: new year");
+    uint32_t recalculations = localClock.getRecalculations();
+    check(clockFollows(1767225600, 86400 * 3), "LocalClock: three days");
+    check(localClock.getRecalculations() - recalculations == 1, "LocalClock: computed in full only once");
+    setTimezone("AEST-10AEDT,M10.1.0,M4.1.0/3");
+    check(clockFollows(1775314800, 7200), "LocalClock: end of DST (southern)");
+    check(clockFollows(1791039600, 7200), "LocalClock: start of DST (southern)");
+    check(clockFollows(1798720200, 7200), "LocalClock: new year (southern)");
+    bool everyHour = true;
+    for (time_t t = 1767225600; t < 1830297600; t += 3593)
+        everyHour &= clockFollows(t, 1);
+    check(everyHour, "LocalClock: two years (southern)");
+    setTimezone(NTP_TIMEZONE);
+
+    // The frame cache of every front cover holds what its tables say
+    bool framesMatch = true;
+    for (uint8_t cover = 0; cover < COVER_COUNT; cover++)
+    {
+        renderer.setFrontCover(cover);
+        for (uint16_t minute = 0; minute < 24 * 60; minute += 5)
+        {
+            uint16_t expected[10] = {};
+            buildFrame(frontCovers[cover], minute / 60, (minute % 60) / 5, expected);
+            renderer.clearScreenBuffer(matrix);
+            renderer.setTime(minute / 60, minute % 60, matrix);
+            framesMatch &= memcmp(matrix, expected, sizeof(expected)) == 0;
+        }
+    }
+    check(framesMatch, "frame cache matches the front cover tables");
+
+    // The front cover tables give the words of the time
+    renderer.setFrontCover(COVER_DE_DE);
+    auto showsWords = [&](uint8_t hours, uint8_t minutes, std::initializer_list<uint16_t> words) {
+        uint16_t expected[10] = {};
+        for (uint16_t word : words)
+            expected[word & 0x000F] |= word & 0xFFE0;
+        renderer.clearScreenBuffer(matrix);
+        renderer.setTime(hours, minutes, matrix);
+        return memcmp(matrix, expected, sizeof(expected)) == 0;
+    };
+    check(showsWords(14, 27, {DE_ESIST, DE_FUENF, DE_VOR, DE_HALB, DE_H_DREI}), "front cover: 5 vor halb");
+    check(showsWords(1, 0, {DE_ESIST, DE_H_EIN, DE_UHR}), "front cover: ein Uhr");
+    check(showsWords(0, 55, {DE_ESIST, DE_FUENF, DE_VOR, DE_H_EINS}), "front cover: 5 vor eins");
+    check(showsWords(23, 45, {DE_ESIST, DE_VIERTEL, DE_VOR, DE_H_ZWOELF}), "front cover: viertel vor zwoelf");
+    renderer.setFrontCover(COVER_EN);
+    check(showsWords(1, 0, {EN_ITIS, EN_H_ONE, EN_OCLOCK}), "front cover: switched to EN");
+    renderer.setFrontCover(COVER_CH_GS);
+    check(showsWords(1, 2, {CH_ESISCH, CH_H_EIS, CH_GSI}), "front cover: CH GS between the five minutes");
+    char weekday[3];
+    renderer.getWeekday(3, weekday);
+    check(strcmp(weekday, "MI") == 0, "front cover: weekday in its language");
+    renderer.setFrontCover(COVER_COUNT);
+    check(renderer.getFrontCover() == FRONTCOVER_DEFAULT, "front cover: unknown falls back to the default");
+    renderer.setFrontCover(settings.mySettings.frontCover);
+
+    // Flash taken by the front covers, all of them are built in. Covers share
+    // their tables with their variants, the frames are their own.
+    std::set<const void *> tables;
+    uint32_t coverBytes = sizeof(frontCovers) + sizeof(frameCaches);
+    for (uint8_t cover = 0; cover < COVER_COUNT; cover++)
+    {
+        uint32_t tableBytes = 0;
+        if (tables.insert(frontCovers[cover].phrases).second)
+            tableBytes += 12 * sizeof(phrase_s);
+        if (tables.insert(frontCovers[cover].hours).second)
+            tableBytes += 24 * sizeof(hour_s);
+        if (tables.insert(frontCovers[cover].weekdays).second)
+            tableBytes += 15;
+        Serial.printf("%-10s %5u bytes tables, %5u bytes frames\n", frontCovers[cover].name, tableBytes, frameCaches[cover].size);
+        coverBytes += tableBytes + frameCaches[cover].size;
+    }
+    Serial.printf("%-10s %5u bytes of flash\n", "covers", coverBytes);
+    check(coverBytes <= FRONTCOVER_FLASH_BUDGET, "front covers fit their flash budget");
+
+    // The textfeed scrolls one column per step without blocking
+    while (stepFeed(matrix))
+        ;
+    while (!feed.isDue())
+        nativeAdvanceMillis(1);
+    feed.add("Hi!", WHITE, FEED_PRIORITY_NORMAL, 1, 0, 100);
+    uint32_t feedSteps = 0;
+    bool feedBlank = true;
+    bool feedShown = false;
+    start = millis();
+    while (true)
+    {
+        if (!feed.isDue())
+        {
+            nativeAdvanceMillis(1);
+            continue;
+        }
+        renderer.clearScreenBuffer(matrix);
+        if (!feed.render(matrix))
+            break;
+        if (!feedSteps)
+        {
+            check(feed.getColumnCount() == fontBig.measure("Hi!") + 2 * 11, "feed has the width of the text");
+            feedBlank = !(matrix[2] | matrix[5] | matrix[8]);
+        }
+        if (feedSteps == 11)
+            feedShown = ((matrix[2] & 0xF800) == 0b1000100000000000) && ((matrix[5] & 0xF800) == 0b1111100000000000);
+        feedSteps++;
+    }
+    check(feedSteps == fontBig.measure("Hi!") + 11 + 1u, "feed scrolls the text through the display");
+    check(feedBlank, "feed starts blank");
+    check(feedShown, "feed shows the text");
+    check(millis() - start >= (feedSteps - 1) * 100u, "feed keeps its speed");
+    check(millis() - start <= feedSteps * 100u, "feed does not fall behind");
+    feed.add("Hi!", WHITE, FEED_PRIORITY_NORMAL);
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        renderer.clearScreenBuffer(matrix);
+        stepFeed(matrix);
+    }
+    uint16_t feedShownMatrix[10];
+    memcpy(feedShownMatrix, matrix, sizeof(matrix));
+    renderer.clearScreenBuffer(matrix);
+    feed.render(matrix);
+    check(memcmp(matrix, feedShownMatrix, sizeof(matrix)) == 0, "feed redraws without moving on before its step is due");
+    while (stepFeed(matrix))
+        ;
+
+    // Texts are UTF-8, other bytes Latin-1
+    const char *utf8 = "\xc3\x84";
+    check((Font::decode(utf8) == 0xC4) && !*utf8, "font decodes UTF-8");
+    const char *latin1 = "\xc4!";
+    check((Font::decode(latin1) == 0xC4) && (*latin1 == '!'), "font takes other bytes as Latin-1");
+    const char *euro = "\xe2\x82\xac";
+    check(Font::decode(euro) == 0x20AC, "font decodes the euro sign");
+    check(substringUtf8("a\xe2\x82\xac", 3) == "a", "texts are cut between UTF-8 characters");
+    check(substringUtf8("a\xe2\x82\xac", 4) == "a\xe2\x82\xac", "texts keep whole UTF-8 characters");
+    check(fontBig.measure("\x01") == fontBig.measure("?"), "font replaces unknown letters");
+    check(fontBig.measure("i") < fontBig.measure("W"), "font has glyphs of variable width");
+    check(fontBig.measure("LT") < fontBig.measure("L") + 1 + fontBig.measure("T"), "font kerns pairs");
+    uint8_t smallColumns[11] = {};
+    check(fontSmall.draw("\xc4", smallColumns, sizeof(smallColumns)) == fontSmall.measure("A"), "small font falls back to the base letter");
+    const uint16_t smallTen[5] = {0b0001001111000000, 0b0011001001000000, 0b0001001001000000, 0b0001001001000000, 0b0011101111000000};
+    renderer.clearScreenBuffer(matrix);
+    renderer.setSmallText("10", TEXT_POS_TOP, matrix);
+    check(memcmp(matrix, smallTen, sizeof(smallTen)) == 0, "small digits are drawn in fixed cells");
+    const uint16_t smallAm[5] = {0b0110001000100000, 0b1001001101100000, 0b1111001010100000, 0b1001001000100000, 0b1001001000100000};
+    renderer.clearScreenBuffer(matrix);
+    renderer.setSmallText("AM", TEXT_POS_MIDDLE, matrix);
+    check(memcmp(&matrix[TEXT_POS_MIDDLE], smallAm, sizeof(smallAm)) == 0, "small letters are drawn in fixed cells");
+    const uint16_t smallSeven[5] = {0b0001111000000000, 0b0000001000000000, 0b0000010000000000, 0b0000010000000000, 0b0000010000000000};
+    renderer.clearScreenBuffer(matrix);
+    renderer.setSmallText("7", TEXT_POS_BOTTOM, matrix);
+    check(memcmp(&matrix[TEXT_POS_BOTTOM], smallSeven, sizeof(smallSeven)) == 0, "single small character is in the middle");
+    renderer.clearScreenBuffer(matrix);
+    renderer.setSmallText("12", TEXT_POS_TOP, matrix);
+    uint16_t matrixNumber[10] = {};
+    renderer.setSmallNumber(12, TEXT_POS_TOP, matrixNumber);
+    check(memcmp(matrix, matrixNumber, sizeof(matrix)) == 0, "small number is drawn like its text");
+    renderer.clearScreenBuffer(matrix);
+    renderer.setSmallText("07", TEXT_POS_TOP, matrix);
+    renderer.clearScreenBuffer(matrixNumber);
+    renderer.setSmallNumber(7, TEXT_POS_TOP, matrixNumber, 2);
+    check(memcmp(matrix, matrixNumber, sizeof(matrix)) == 0, "small number has leading zeros");
+
+    // Icons are drawn from the sprite atlas
+    const uint16_t fullMoon[10] = {0b0000111000000000, 0b0011111110000000, 0b0111111111000000, 0b0111111111000000, 0b1111111111100000,
+                                   0b1111111111100000, 0b0111111111000000, 0b0111111111000000, 0b0011111110000000, 0b0000111000000000};
+    renderer.clearScreenBuffer(matrix);
+    renderer.setSprite((eSprite)(SPRITE_MOON + 4), 0, 0, matrix);
+    check(memcmp(matrix, fullMoon, sizeof(matrix)) == 0, "sprite: full moon");
+    renderer.clearScreenBuffer(matrix);
+    renderer.setSprite(SPRITE_THERMOMETER, 8, 0, matrix);
+    renderer.setSprite(SPRITE_PLUS, 0, 1, matrix);
+    check((matrix[0] == 0b0000000001000000) && (matrix[1] == 0b0100000010100000) && (matrix[2] == 0b1110000010100000) &&
+              (matrix[3] == 0b0100000011100000) && !matrix[4],
+          "sprite: thermometer and plus");
+    renderer.setSprite(SPRITE_PLUS, 0, 1, matrix, BLIT_AND_NOT);
+    check((matrix[1] == 0b0000000010100000) && (matrix[2] == 0b0000000010100000), "sprite: drawn with AND NOT");
+    renderer.clearScreenBuffer(matrix);
+    renderer.setCorners(4, matrix);
+    renderer.setSprite(SPRITE_MINUS, 9, 0, matrix);
+    renderer.setSprite(SPRITE_MINUS, -2, 9, matrix);
+    renderer.setSprite((eSprite)(SPRITE_MOON + 4), 0, 8, matrix);
+    renderer.setSprite(SPRITE_PLUS, 20, 0, matrix);
+    check((matrix[0] == 0b0000000001110000) && (matrix[8] == 0b0000111000000000) && (matrix[9] == 0b1011111110000000),
+          "sprite: clipped at the edges of the display");
+    benchmark("Renderer::setSprite", 100000, [&](uint32_t i) {
+        renderer.setSprite((eSprite)(SPRITE_MOON + i % 8), 0, 0, matrix);
+    });
+
+    // Drawing a frame must not touch the heap (recording frames on the host does)
+    bool recordFrames = nativeRecordFrames;
+    nativeRecordFrames = false;
+    uint32_t allocations = nativeAllocations();
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        char weekday[3];
+        renderer.clearScreenBuffer(matrix);
+        renderer.setTime(i % 24, i % 60, matrix);
+        renderer.setCorners(i % 60, matrix);
+        writeScreenBuffer(matrix, WHITE, 255);
+        renderer.clearScreenBuffer(matrix);
+        renderer.getWeekday(i % 7, weekday);
+        renderer.setSmallText(weekday, TEXT_POS_MIDDLE, matrix);
+        writeScreenBuffer(matrix, WHITE, 255);
+        renderer.clearScreenBuffer(matrix);
+        renderer.setSmallText("TI", TEXT_POS_TOP, matrix);
+        renderer.setSmallNumber(i % 100, TEXT_POS_BOTTOM, matrix);
+        writeScreenBuffer(matrix, WHITE, 255);
+        renderer.clearScreenBuffer(matrix);
+        stepFeed(matrix);
+    }
+    check(nativeAllocations() == allocations, "no heap allocations per frame");
+    nativeRecordFrames = recordFrames;
+
+    // Queued messages by priority, then in order of arrival
+    std::vector<uint16_t> feedOrder;
+    auto drainFeed = [&]() {
+        feedOrder.clear();
+        uint16_t columnCount = 0;
+        while (stepFeed(matrix))
+            if (feed.getColumnCount() != columnCount)
+                feedOrder.push_back(columnCount = feed.getColumnCount());
+    };
+    feed.add("a", WHITE, FEED_PRIORITY_LOW);
+    feed.add("bb", WHITE, FEED_PRIORITY_NORMAL);
+    feed.add("ccc", WHITE, FEED_PRIORITY_HIGH);
+    feed.add("dddd", WHITE, FEED_PRIORITY_NORMAL);
+    check(!feed.add("eeeee", WHITE, FEED_PRIORITY_LOW), "feed queue keeps its size");
+    check(feed.add("ffffff", WHITE, FEED_PRIORITY_HIGH), "feed drops a lower priority if full");
+    drainFeed();
+    check(feedOrder == std::vector<uint16_t>({(uint16_t)(22 + fontBig.measure("ccc")), (uint16_t)(22 + fontBig.measure("ffffff")),
+                                              (uint16_t)(22 + fontBig.measure("bb")), (uint16_t)(22 + fontBig.measure("dddd"))}), "feed shows by priority");
+    feed.add("a", WHITE, FEED_PRIORITY_NORMAL, 2);
+    feed.add("bb", WHITE, FEED_PRIORITY_NORMAL);
+    drainFeed();
+    check(feedOrder == std::vector<uint16_t>({(uint16_t)(22 + fontBig.measure("a")), (uint16_t)(22 + fontBig.measure("bb")),
+                                              (uint16_t)(22 + fontBig.measure("a"))}), "feed repeats behind the others");
+    feed.add("a", WHITE, FEED_PRIORITY_NORMAL, 1, 1);
+    nativeAdvanceMillis(1000);
+    check(!feed.render(matrix), "feed drops expired messages");
+
+    // Inputs are debounced in the loop and turned into gestures
+    Input buttons;
+    buttons.setHandler([](eInputSource source, eInputGesture gesture) { gestures.push_back(source * 10 + gesture); });
+    nativeAdvanceMillis(1000);
+    auto edges = [&](eInputSource source, std::vector<uint8_t> steps) {
+        boolean pressed = false;
+        for (uint8_t step : steps)
+        {
+            buttons.push(source, pressed = !pressed);
+            nativeAdvanceMillis(step);
+        }
+        buttons.handle();
+    };
+    edges(INPUT_TIME, {2, 3, 1, 30});
+    check(gestures == std::vector<uint8_t>({INPUT_TIME * 10 + INPUT_PRESS}), "input debounces a press");
+    nativeAdvanceMillis(50);
+    buttons.handle();
+    nativeAdvanceMillis(INPUT_DEBOUNCE_MS);
+    edges(INPUT_TIME, {1, 2, 1, 100});
+    check(gestures.size() == 3 && gestures[2] == INPUT_TIME * 10 + INPUT_DOUBLE_PRESS, "input sees a double press");
+    nativeAdvanceMillis(INPUT_DEBOUNCE_MS);
+    edges(INPUT_TIME, {1, 1});
+    check(gestures.size() == 4, "input starts over after a double press");
+    gestures.clear();
+    nativeAdvanceMillis(INPUT_DOUBLE_PRESS_MS);
+    buttons.handle();
+    buttons.push(INPUT_MODE, true);
+    for (uint32_t i = 0; i < 2 * INPUT_LONG_PRESS_MS; i += 10)
+    {
+        nativeAdvanceMillis(10);
+        buttons.handle();
+    }
+    buttons.push(INPUT_MODE, false);
+    buttons.handle();
+    check(gestures == std::vector<uint8_t>({INPUT_MODE * 10 + INPUT_PRESS, INPUT_MODE * 10 + INPUT_LONG_PRESS}), "input sees a long press once");
+    gestures.clear();
+    nativeAdvanceMillis(INPUT_DOUBLE_PRESS_MS);
+    buttons.click(INPUT_ONOFF);
+    nativeAdvanceMillis(INPUT_DEBOUNCE_MS);
+    buttons.handle();
+    check(gestures == std::vector<uint8_t>({INPUT_ONOFF * 10 + INPUT_PRESS}), "input takes IR clicks");
+    for (uint8_t i = 0; i < INPUT_QUEUE_SIZE + 4; i++)
+        buttons.push(INPUT_ONOFF, i & 1);
+    check(buttons.getDropped() == 5, "input drops edges if the queue is full");
+    buttons.handle();
+    gestures.clear();
+    nativeAdvanceMillis(INPUT_DEBOUNCE_MS);
+    buttons.handle();
+    check(!gestures.empty() && gestures[0] == INPUT_ONOFF * 10 + INPUT_PRESS, "input keeps the last level if the queue is full");
+    buttons.push(INPUT_ONOFF, false);
+    nativeAdvanceMillis(INPUT_DEBOUNCE_MS);
+    buttons.handle();
+
+    // A transition must not block the loop
+    startTransition(TRANSITION_FADE, matrixOld, matrix, WHITE, 255);
+    check(isTransitionRunning(), "transition runs in the background");
+    stopTransition();
+
+    Serial.printf("%u frames shown, %u skipped, %d failures\n",
+                  ledDriver.getShownFrames(), ledDriver.getSkippedFrames(), failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,35 @@
+//*****************************************************************************
+// EEPROM.h
+// Host mock of the ESP8266 EEPROM emulation.
+//*****************************************************************************
+
+#pragma once
+
+#include "Arduino.h"
+
+class EEPROMClass
+{
+public:
+    void begin(size_t) {}
+    void end() {}
+    bool commit() { return true; }
+
+    template <typename T>
+    T &get(int address, T &t)
+    {
+        memcpy(&t, &data[address], sizeof(T));
+        return t;
+    }
+
+    template <typename T>
+    const T &put(int address, const T &t)
+    {
+        memcpy(&data[address], &t, sizeof(T));
+        return t;
+    }
+
+private:
+    uint8_t data[4096] = {};
+};
+
+extern EEPROMClass EEPROM;
@@ -39,6 +39,8 @@ enum eColor : uint8_t
 	COLOR_COUNT = PINK
 };
 
+#define COLOR_NONE 0xFF // LED off in a color screenbuffer.
+
 struct color_s
 {
 	uint8_t red;
@@ -46,7 +48,7 @@ struct color_s
 	uint8_t blue;
 };
 
-const color_s defaultColors[] =
+constexpr color_s defaultColors[] =
 {
 	{ 0xFF, 0xFF, 0xFF }, // 00 WHITE
 
@@ -27,6 +27,7 @@
                                                 // GREEN, GREEN_25, GREEN_50, MINTGREEN, CYAN, CYAN_25, CYAN_50, LIGHTBLUE, BLUE,
                                                 // BLUE_25, BLUE_50, VIOLET, MAGENTA, MAGENTA_25, MAGENTA_50, PINK.
 // #define ABUSE_CORNER_LED_FOR_ALARM           // Use the upper right minute LED as alarm LED. Only works if ALARM_LED_COLOR is defined.
+// #define ENTRY_WORDS_COLOR BLUE               // Color of the entry words ("IT IS"). If not defined the display color will be used.
 
 #define SHOW_IP                                 // Show local IP at startup. Use this to access the clocks on WiFi or AP.
 // #define POWERON_SELFTEST                     // Test LEDs at startup. Order is: red, green, blue, white.
@@ -43,8 +44,8 @@
 #define TIMEZONE "Europe/Berlin"                // Check out https://open-meteo.com/ for more info.
 
 //*****************************************************************************
-// Frontcover of the clock.
-// This also sets the language of the menu and website (where available).
+// Frontcover of the clock at the first start. It can be changed on the
+// settings page. This also sets the language of the menu and website (where available).
 //*****************************************************************************
 
 // #define FRONTCOVER_EN
@@ -83,10 +84,19 @@
 #define NUMPIXELS 115                           // Number of LEDs in the strip.
 #define MIN_BRIGHTNESS 20                       // Minimum brightness of LEDs from 0 to 255.
 #define MAX_BRIGHTNESS 240                      // Maximum brightness of LEDs from 0 to 255.
+#define BRIGHTNESS_GAMMA                        // Brightness follows the perception of the eye (CIE lightness) instead of being linear.
+                                                // Only above MIN_BRIGHTNESS, which gives the same output as without.
+// #define TEMPORAL_DITHERING                   // Dither the LED output over 16 frames. Gives fades 12 bit resolution.
+#define TRANSITION_FADE_FRAMES 30               // Frames of a fade, spread over the transition time. Same CPU load at any brightness.
+#define IDLE_SLEEP_MS 20                        // Sleep up to this many ms when no task is due. Comment to run the loop flat out.
+#define FEED_SPEED 120                          // Time in ms to scroll the textfeed by one column.
 
 // #define ONOFF_BUTTON                         // Use a hardware on/off-button.
 // #define MODE_BUTTON                          // Use a hardware mode-button.
 // #define TIME_BUTTON                          // Use a hardware time-button. Debug to serial will not work if defined.
+#define INPUT_DEBOUNCE_MS 50                    // Ignore bounces of a button for this many ms.
+#define INPUT_LONG_PRESS_MS 1000                // Hold a button this many ms for a long press.
+#define INPUT_DOUBLE_PRESS_MS 400               // Press a button twice within this many ms for a double press.
 
 // #define SENSOR_DHT22                         // Use a DHT22 sensor module (not the plain sensor) for room temperature and humidity.
 #define DHT_TEMPERATURE_OFFSET 0.5              // Sets how many degrees the measured room temperature (+ or -) should be corrected.
@@ -102,11 +112,29 @@
 
 #define NEOPIXEL_RGB                            // Enable if your LEDs are RGB only.
 // #define NEOPIXEL_RGBW                        // Enable if your LEDs have a distinct white channel (RGBW).
+#define RGBW_WHITE_POINT 255, 255, 255          // Color of the white LEDs of an RGBW strip as red, green, blue.
+                                                // Cold white (6500K): 255, 255, 255
+                                                // Neutral white (4000K): 255, 206, 166
+                                                // Warm white (3000K): 255, 180, 107
+                                                // Warm white (2700K): 255, 167, 87
+
+// #define POWER_LIMIT_MA 2000                  // Dim the LEDs if a frame would need more current than this (in mA).
+#define LED_CHANNEL_MA 20                       // Current of one color channel of a LED at full brightness (in mA).
+#define LED_IDLE_MA 1                           // Current of one LED when it is off (in mA).
 
 #define NEOPIXEL_TYPE NEO_GRB + NEO_KHZ800      // Specifies the NeoPixel driver. 400kHz, 800kHz, GRB, RGB, GRBW, RGBW...
 // #define NEOPIXEL_TYPE NEO_WRGB + NEO_KHZ800  // Check out "Adafruit_NeoPixel.h" for more information.
 // #define NEOPIXEL_TYPE NEO_GRBW + NEO_KHZ800
 
+// #define LED_DRIVER_DMA                       // Send frames in the background with NeoPixelBus instead of Adafruit_NeoPixel.
+                                                // The CPU and interrupts are not blocked while the LEDs are updated.
+#define NEOPIXELBUS_FEATURE NeoGrbFeature       // Color order for NeoPixelBus. NeoGrbFeature, NeoRgbFeature, NeoGrbwFeature...
+#define NEOPIXELBUS_METHOD NeoEsp8266Dma800KbpsMethod
+#define NEOPIXELBUS_PIN 3                       // I2S DMA. Data is sent on GPIO3 (RX), so ONOFF_BUTTON can not be used.
+// #define NEOPIXELBUS_METHOD NeoEsp8266AsyncUart1800KbpsMethod
+// #define NEOPIXELBUS_PIN 2                    // Asynchronous UART1. Data is sent on GPIO2 (D4), so ESP_LED can not be used.
+                                                // Set PIN_LEDS_DATA to NEOPIXELBUS_PIN.
+
 //*****************************************************************************
 // IR remote control
 // Press a button on the remote control in front of the clock.
@@ -128,6 +156,8 @@
 
 //*****************************************************************************
 // LED layouts
+// The tables are defined in LedLayout.h. Other serpentine wirings can be
+// added there with serpentineLayout().
 //*****************************************************************************
 
 #define LED_LAYOUT_HORIZONTAL_1                 // Horizontal, corner and alarm LEDs at the end of the strip. (As seen from the front.)
@@ -200,6 +230,7 @@
 // #define DEBUG_IR                             // Show debug infos from the IR remote.
 // #define DEBUG_LDR                            // Show debug infos for the LDR.
 // #define DEBUG_FPS                            // Show number of loops per second in the serial console.
+// #define DEBUG_PROFILER                       // Measure the display pipeline. See /profiler and the serial console.
 
 // WeMos D1 R2 & mini (Espressif 8266)
 #define PIN_IR_RECEIVER  16                     // D0 (no interrupt)
@@ -0,0 +1,150 @@
+//*****************************************************************************
+// Feed.cpp
+//*****************************************************************************
+
+#include "Feed.h"
+#include "Debug.h"
+#include "Font.h"
+
+Feed::Feed()
+{
+    memset(queue, 0, sizeof(queue));
+    sequence = 0;
+    columnCount = 0;
+    position = 0;
+    color = WHITE;
+    speed = FEED_SPEED;
+    nextStep = 0;
+}
+
+// Queue a message. It is shown "repeat" times and dropped if it did not get
+// its turn within "expiry" seconds (0: never). A full queue drops the oldest
+// message with a lower priority.
+boolean Feed::add(const char *text, uint8_t color, eFeedPriority priority, uint8_t repeat, uint16_t expiry, uint16_t speed)
+{
+    message_s *slot = nullptr;
+    for (message_s &message : queue)
+    {
+        if (!message.repeat)
+        {
+            slot = &message;
+            break;
+        }
+        if ((message.priority < priority) &&
+            (!slot || (message.priority < slot->priority) || ((message.priority == slot->priority) && (message.sequence < slot->sequence))))
+            slot = &message;
+    }
+    if (!slot)
+    {
+        DEBUG_SERIAL_PRINTLN(F("[ERROR] Feed queue is full"));
+        return false;
+    }
+    strncpy(slot->text, text, FEED_MAX_CHARS);
+    slot->text[FEED_MAX_CHARS] = '\0';
+    slot->color = color;
+    slot->priority = priority;
+    slot->repeat = repeat ? repeat : 1;
+    slot->added = millis();
+    slot->expiry = expiry;
+    slot->speed = speed;
+    slot->sequence = sequence++;
+    return true;
+}
+
+// True if the feed has to move on.
+boolean Feed::isDue()
+{
+    return (int32_t)(millis() - nextStep) >= 0;
+}
+
+// millis() when the feed moves on.
+uint32_t Feed::getNextStep()
+{
+    return nextStep;
+}
+
+// Draw the visible part of the feed into rows 2 to 8 and move on by one column
+// if that is due. Otherwise the columns shown are drawn again.
+// Returns false once the last message has left the display.
+boolean Feed::render(uint16_t screenBuffer[])
+{
+    if (position && !isDue())
+    {
+        draw(position - 1, screenBuffer);
+        return true;
+    }
+    if ((position + FEED_WIDTH > columnCount) && !next())
+        return false;
+    draw(position, screenBuffer);
+    position++;
+
+    // Do not catch up on steps missed.
+    nextStep += speed;
+    if (isDue())
+        nextStep = millis() + speed;
+    return true;
+}
+
+// Draw the columns from "first" on into rows 2 to 8.
+void Feed::draw(uint16_t first, uint16_t screenBuffer[])
+{
+    for (uint8_t x = 0; x < FEED_WIDTH; x++)
+    {
+        uint8_t column = columns[first + x];
+        for (uint8_t y = 0; column; y++, column >>= 1)
+            if (column & 1)
+                screenBuffer[2 + y] |= 1 << (15 - x);
+    }
+}
+
+uint8_t Feed::getColor()
+{
+    return color;
+}
+
+uint16_t Feed::getColumnCount()
+{
+    return columnCount;
+}
+
+// Start the message with the highest priority, the oldest first.
+boolean Feed::next()
+{
+    message_s *best = nullptr;
+    for (message_s &message : queue)
+    {
+        if (message.repeat && message.expiry && (millis() - message.added >= message.expiry * 1000UL))
+        {
+            DEBUG_SERIAL_PRINTLN(F("Feed expired: ") + String(message.text));
+            message.repeat = 0;
+        }
+        if (!message.repeat)
+            continue;
+        if (!best || (message.priority > best->priority) || ((message.priority == best->priority) && (message.sequence < best->sequence)))
+            best = &message;
+    }
+    if (!best)
+    {
+        columnCount = 0;
+        position = 0;
+        return false;
+    }
+    color = best->color;
+    speed = best->speed;
+    setText(best->text);
+
+    // A repeat waits behind the other messages of its priority.
+    best->repeat--;
+    best->sequence = sequence++;
+    return true;
+}
+
+// Draw the text into the column stream. It scrolls in from the right and out to the left.
+void Feed::setText(const char *text)
+{
+    memset(columns, 0, sizeof(columns));
+    uint16_t width = fontBig.draw(text, columns + FEED_WIDTH, FEED_MAX_COLUMNS - 2 * FEED_WIDTH);
+    columnCount = min(width, (uint16_t)(FEED_MAX_COLUMNS - 2 * FEED_WIDTH)) + 2 * FEED_WIDTH;
+    position = 0;
+    nextStep = millis();
+}
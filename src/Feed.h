@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+#include "Colors.h"
+#include "Configuration.h"
+
+#define FEED_MAX_CHARS 100
+#define FEED_QUEUE_SIZE 4
+#define FEED_WIDTH 11 // Columns on the display
+#define FEED_MAX_COLUMNS (FEED_MAX_CHARS * 6 + 2 * FEED_WIDTH)
+
+// Messages with a higher priority are shown first.
+enum eFeedPriority : uint8_t {
+    FEED_PRIORITY_LOW,    // Events
+    FEED_PRIORITY_NORMAL, // Texts from the web API
+    FEED_PRIORITY_HIGH    // Notices of the clock
+};
+
+// Textfeed. Messages wait in a queue until the one shown has scrolled
+// through. The text (UTF-8) is drawn into a stream of columns (one bit per
+// row) which is then scrolled through the display one column every "speed" ms.
+class Feed
+{
+public:
+    Feed();
+
+    boolean add(const char *text, uint8_t color, eFeedPriority priority, uint8_t repeat = 1, uint16_t expiry = 0, uint16_t speed = FEED_SPEED);
+    boolean isDue();
+    uint32_t getNextStep();
+    boolean render(uint16_t screenBuffer[]);
+    uint8_t getColor();
+    uint16_t getColumnCount();
+
+private:
+    struct message_s
+    {
+        char text[FEED_MAX_CHARS + 1];
+        uint8_t color;
+        eFeedPriority priority;
+        uint8_t repeat; // Times left to show, 0: free
+        uint32_t added; // millis()
+        uint16_t expiry; // s, 0: never
+        uint16_t speed;
+        uint32_t sequence; // Order of arrival
+    } queue[FEED_QUEUE_SIZE];
+    uint32_t sequence;
+
+    uint8_t columns[FEED_MAX_COLUMNS];
+    uint16_t columnCount;
+    uint16_t position; // First column on the display
+    uint8_t color;
+    uint16_t speed; // ms per column
+    uint32_t nextStep; // millis()
+
+    boolean next();
+    void draw(uint16_t first, uint16_t screenBuffer[]);
+    void setText(const char *text);
+};
@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Font.cpp
+//*****************************************************************************
+
+#include "Font.h"
+#include "Glyphs.h"
+
+Font fontBig(fontBigGlyphs, sizeof(fontBigGlyphs) / sizeof(glyph_s), fontBigColumns,
+             fontBigKerning, sizeof(fontBigKerning) / sizeof(kerning_s));
+Font fontSmall(fontSmallGlyphs, sizeof(fontSmallGlyphs) / sizeof(glyph_s), fontSmallColumns, nullptr, 0);
+
+// Base letters of Latin-1 0xC0 to 0xFF for fonts without accents.
+static const char latin1Base[] PROGMEM = "AAAAAAACEEEEIIIIDNOOOOOxOUUUUYPsaaaaaaaceeeeiiiidnooooo/ouuuuypy";
+
+Font::Font(const glyph_s *glyphs, uint16_t glyphCount, const uint8_t *columns, const kerning_s *kerning, uint8_t kerningCount)
+{
+    this->glyphs = glyphs;
+    this->glyphCount = glyphCount;
+    this->columns = columns;
+    this->kerning = kerning;
+    this->kerningCount = kerningCount;
+}
+
+// Next codepoint of a UTF-8 text. Moves text on.
+uint16_t Font::decode(const char *&text)
+{
+    uint8_t c = *text++;
+    if (c < 0x80)
+        return c;
+    if (((c & 0xE0) == 0xC0) && ((text[0] & 0xC0) == 0x80))
+        return ((c & 0x1F) << 6) | (*text++ & 0x3F);
+    if (((c & 0xF0) == 0xE0) && ((text[0] & 0xC0) == 0x80) && ((text[1] & 0xC0) == 0x80))
+    {
+        uint16_t codepoint = ((c & 0x0F) << 12) | ((text[0] & 0x3F) << 6) | (text[1] & 0x3F);
+        text += 2;
+        return codepoint;
+    }
+    return c; // Latin-1
+}
+
+// Width of a text in columns.
+uint16_t Font::measure(const char *text)
+{
+    return draw(text, nullptr, 0);
+}
+
+// OR the columns of a text into buffer. Returns the width of the text,
+// columns beyond size are dropped.
+uint16_t Font::draw(const char *text, uint8_t buffer[], uint16_t size)
+{
+    uint16_t x = 0;
+    uint16_t last = 0;
+    while (*text)
+    {
+        uint16_t codepoint = decode(text);
+        int16_t glyph = getGlyph(codepoint);
+        if (glyph < 0)
+            continue;
+        if (last)
+            x += 1 + getKerning(last, codepoint);
+        x += copyGlyph(glyph, buffer, x, size);
+        last = codepoint;
+    }
+    return x;
+}
+
+// OR the columns of one character into buffer. Returns its width.
+uint8_t Font::drawGlyph(uint16_t codepoint, uint8_t buffer[], uint16_t size)
+{
+    int16_t glyph = getGlyph(codepoint);
+    if (glyph < 0)
+        return 0;
+    return copyGlyph(glyph, buffer, 0, size);
+}
+
+// OR the columns of a glyph into buffer from column x on. Returns its width.
+uint8_t Font::copyGlyph(int16_t glyph, uint8_t buffer[], uint16_t x, uint16_t size)
+{
+    uint16_t offset = pgm_read_word(&glyphs[glyph].offset);
+    uint8_t width = pgm_read_byte(&glyphs[glyph].width);
+    for (uint8_t i = 0; i < width; i++)
+        if (x + i < size)
+            buffer[x + i] |= pgm_read_byte(&columns[offset + i]);
+    return width;
+}
+
+// Binary search in the glyphs. -1 if the font has no such glyph.
+int16_t Font::findGlyph(uint16_t codepoint)
+{
+    int16_t low = 0;
+    int16_t high = glyphCount - 1;
+    while (low <= high)
+    {
+        int16_t middle = (low + high) / 2;
+        uint16_t found = pgm_read_word(&glyphs[middle].codepoint);
+        if (found == codepoint)
+            return middle;
+        if (found < codepoint)
+            low = middle + 1;
+        else
+            high = middle - 1;
+    }
+    return -1;
+}
+
+// The glyph for a codepoint, the base letter if the font has no accents,
+// the capital if it has no lower case or "?".
+int16_t Font::getGlyph(uint16_t codepoint)
+{
+    int16_t glyph = findGlyph(codepoint);
+    if ((glyph < 0) && (codepoint >= 0xC0) && (codepoint <= 0xFF))
+    {
+        codepoint = pgm_read_byte(&latin1Base[codepoint - 0xC0]);
+        glyph = findGlyph(codepoint);
+    }
+    if ((glyph < 0) && (codepoint >= 'a') && (codepoint <= 'z'))
+        glyph = findGlyph(codepoint - 'a' + 'A');
+    if (glyph < 0)
+        glyph = findGlyph('?');
+    return glyph;
+}
+
+int8_t Font::getKerning(uint16_t left, uint16_t right)
+{
+    for (uint8_t i = 0; i < kerningCount; i++)
+    {
+        if ((pgm_read_word(&kerning[i].left) == left) && (pgm_read_word(&kerning[i].right) == right))
+            return (int8_t)pgm_read_byte(&kerning[i].offset);
+    }
+    return 0;
+}
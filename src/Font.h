@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+
+// A glyph of a font. The columns of all glyphs are stored one after the other.
+struct glyph_s
+{
+    uint16_t codepoint; // Unicode
+    uint16_t offset; // First column
+    uint8_t width; // Columns
+};
+
+// Extra space between two glyphs (negative: closer).
+struct kerning_s
+{
+    uint16_t left;
+    uint16_t right;
+    int8_t offset;
+};
+
+// Bitmap font in PROGMEM with glyphs of variable width. One byte per column,
+// bit 0 is the top row. Texts are UTF-8; bytes which are not part of a UTF-8
+// sequence are taken as Latin-1.
+class Font
+{
+public:
+    Font(const glyph_s *glyphs, uint16_t glyphCount, const uint8_t *columns, const kerning_s *kerning, uint8_t kerningCount);
+
+    static uint16_t decode(const char *&text);
+    uint16_t measure(const char *text);
+    uint16_t draw(const char *text, uint8_t buffer[], uint16_t size);
+    uint8_t drawGlyph(uint16_t codepoint, uint8_t buffer[], uint16_t size);
+
+private:
+    const glyph_s *glyphs; // Sorted by codepoint
+    uint16_t glyphCount;
+    const uint8_t *columns;
+    const kerning_s *kerning;
+    uint8_t kerningCount;
+
+    int16_t findGlyph(uint16_t codepoint);
+    int16_t getGlyph(uint16_t codepoint);
+    int8_t getKerning(uint16_t left, uint16_t right);
+    uint8_t copyGlyph(int16_t glyph, uint8_t buffer[], uint16_t x, uint16_t size);
+};
+
+extern Font fontBig; // 7 rows: ASCII, Latin-1 and the euro sign
+extern Font fontSmall; // 5 rows: capitals and digits
@@ -0,0 +1,490 @@
+#pragma once
+
+#include <Arduino.h>
+#include "Configuration.h"
+#include "Renderer.h"
+#include "Words.h"
+
+// The words for five minutes, e.g. "FUENF VOR HALB" and the hour they refer to.
+struct phrase_s
+{
+    uint16_t words[4];
+    uint8_t nextHour; // 1: the phrase counts to the next hour
+};
+
+// The words for an hour, e.g. "EINS" or "LA UNA".
+struct hour_s
+{
+    uint16_t words[2];
+    uint16_t fullHour; // Replaces words[0] on the full hour if set, e.g. "EIN UHR"
+};
+
+// A front cover as data. The frame cache is built from these tables.
+struct frontCover_s
+{
+    const char *name;
+    uint16_t intro; // Always on, e.g. "ES IST"
+    uint16_t entryWords[2]; // Removed by Renderer::clearEntryWords()
+    uint16_t fullHour; // On the full hour, e.g. "UHR"
+    uint16_t between; // Between the five minutes
+    uint16_t am;
+    uint16_t pm;
+    const phrase_s *phrases; // 12, one for every five minutes
+    const hour_s *hours; // 24
+    const char *weekdays; // Two letters each, sunday first
+};
+
+//*****************************************************************************
+// DE
+//*****************************************************************************
+
+#define DE_HOURS(n, full) {{n, NO_WORD}, full}
+static constexpr hour_s hoursDe[24] PROGMEM = {
+    DE_HOURS(DE_H_ZWOELF, NO_WORD), DE_HOURS(DE_H_EINS, DE_H_EIN), DE_HOURS(DE_H_ZWEI, NO_WORD), DE_HOURS(DE_H_DREI, NO_WORD),
+    DE_HOURS(DE_H_VIER, NO_WORD), DE_HOURS(DE_H_FUENF, NO_WORD), DE_HOURS(DE_H_SECHS, NO_WORD), DE_HOURS(DE_H_SIEBEN, NO_WORD),
+    DE_HOURS(DE_H_ACHT, NO_WORD), DE_HOURS(DE_H_NEUN, NO_WORD), DE_HOURS(DE_H_ZEHN, NO_WORD), DE_HOURS(DE_H_ELF, NO_WORD),
+    DE_HOURS(DE_H_ZWOELF, NO_WORD), DE_HOURS(DE_H_EINS, DE_H_EIN), DE_HOURS(DE_H_ZWEI, NO_WORD), DE_HOURS(DE_H_DREI, NO_WORD),
+    DE_HOURS(DE_H_VIER, NO_WORD), DE_HOURS(DE_H_FUENF, NO_WORD), DE_HOURS(DE_H_SECHS, NO_WORD), DE_HOURS(DE_H_SIEBEN, NO_WORD),
+    DE_HOURS(DE_H_ACHT, NO_WORD), DE_HOURS(DE_H_NEUN, NO_WORD), DE_HOURS(DE_H_ZEHN, NO_WORD), DE_HOURS(DE_H_ELF, NO_WORD)};
+
+static constexpr phrase_s phrasesDeDe[12] PROGMEM = {
+    {{NO_WORD}, 0},                      // Uhr
+    {{DE_FUENF, DE_NACH}, 0},            // 5 nach
+    {{DE_ZEHN, DE_NACH}, 0},             // 10 nach
+    {{DE_VIERTEL, DE_NACH}, 0},          // viertel nach
+    {{DE_ZWANZIG, DE_NACH}, 0},          // 20 nach
+    {{DE_FUENF, DE_VOR, DE_HALB}, 1},    // 5 vor halb
+    {{DE_HALB}, 1},                      // halb
+    {{DE_FUENF, DE_NACH, DE_HALB}, 1},   // 5 nach halb
+    {{DE_ZWANZIG, DE_VOR}, 1},           // 20 vor
+    {{DE_VIERTEL, DE_VOR}, 1},           // viertel vor
+    {{DE_ZEHN, DE_VOR}, 1},              // 10 vor
+    {{DE_FUENF, DE_VOR}, 1}};            // 5 vor
+
+static constexpr phrase_s phrasesDeSw[12] PROGMEM = {
+    {{NO_WORD}, 0},                      // Uhr
+    {{DE_FUENF, DE_NACH}, 0},            // 5 nach
+    {{DE_ZEHN, DE_NACH}, 0},             // 10 nach
+    {{DE_VIERTEL}, 1},                   // viertel
+    {{DE_ZWANZIG, DE_NACH}, 0},          // 20 nach
+    {{DE_FUENF, DE_VOR, DE_HALB}, 1},    // 5 vor halb
+    {{DE_HALB}, 1},                      // halb
+    {{DE_FUENF, DE_NACH, DE_HALB}, 1},   // 5 nach halb
+    {{DE_ZWANZIG, DE_VOR}, 1},           // 20 vor
+    {{DE_DREIVIERTEL}, 1},               // dreiviertel
+    {{DE_ZEHN, DE_VOR}, 1},              // 10 vor
+    {{DE_FUENF, DE_VOR}, 1}};            // 5 vor
+
+static constexpr phrase_s phrasesDeBa[12] PROGMEM = {
+    {{NO_WORD}, 0},                      // Uhr
+    {{DE_FUENF, DE_NACH}, 0},            // 5 nach
+    {{DE_ZEHN, DE_NACH}, 0},             // 10 nach
+    {{DE_VIERTEL, DE_NACH}, 0},          // viertel nach
+    {{DE_ZWANZIG, DE_NACH}, 0},          // 20 nach
+    {{DE_FUENF, DE_VOR, DE_HALB}, 1},    // 5 vor halb
+    {{DE_HALB}, 1},                      // halb
+    {{DE_FUENF, DE_NACH, DE_HALB}, 1},   // 5 nach halb
+    {{DE_ZWANZIG, DE_VOR}, 1},           // 20 vor
+    {{DE_DREIVIERTEL}, 1},               // dreiviertel
+    {{DE_ZEHN, DE_VOR}, 1},              // 10 vor
+    {{DE_FUENF, DE_VOR}, 1}};            // 5 vor
+
+static constexpr phrase_s phrasesDeSa[12] PROGMEM = {
+    {{NO_WORD}, 0},                      // Uhr
+    {{DE_FUENF, DE_NACH}, 0},            // 5 nach
+    {{DE_ZEHN, DE_NACH}, 0},             // 10 nach
+    {{DE_VIERTEL}, 1},                   // viertel
+    {{DE_ZEHN, DE_VOR, DE_HALB}, 1},     // 10 vor halb
+    {{DE_FUENF, DE_VOR, DE_HALB}, 1},    // 5 vor halb
+    {{DE_HALB}, 1},                      // halb
+    {{DE_FUENF, DE_NACH, DE_HALB}, 1},   // 5 nach halb
+    {{DE_ZEHN, DE_NACH, DE_HALB}, 1},    // 10 nach halb
+    {{DE_DREIVIERTEL}, 1},               // dreiviertel
+    {{DE_ZEHN, DE_VOR}, 1},              // 10 vor
+    {{DE_FUENF, DE_VOR}, 1}};            // 5 vor
+
+//*****************************************************************************
+// DE_MKF
+//*****************************************************************************
+
+#define DE_MKF_HOURS(n, full) {{n, NO_WORD}, full}
+static constexpr hour_s hoursDeMkf[24] PROGMEM = {
+    DE_MKF_HOURS(DE_MKF_H_ZWOELF, NO_WORD), DE_MKF_HOURS(DE_MKF_H_EINS, DE_MKF_H_EIN), DE_MKF_HOURS(DE_MKF_H_ZWEI, NO_WORD), DE_MKF_HOURS(DE_MKF_H_DREI, NO_WORD),
+    DE_MKF_HOURS(DE_MKF_H_VIER, NO_WORD), DE_MKF_HOURS(DE_MKF_H_FUENF, NO_WORD), DE_MKF_HOURS(DE_MKF_H_SECHS, NO_WORD), DE_MKF_HOURS(DE_MKF_H_SIEBEN, NO_WORD),
+    DE_MKF_HOURS(DE_MKF_H_ACHT, NO_WORD), DE_MKF_HOURS(DE_MKF_H_NEUN, NO_WORD), DE_MKF_HOURS(DE_MKF_H_ZEHN, NO_WORD), DE_MKF_HOURS(DE_MKF_H_ELF, NO_WORD),
+    DE_MKF_HOURS(DE_MKF_H_ZWOELF, NO_WORD), DE_MKF_HOURS(DE_MKF_H_EINS, DE_MKF_H_EIN), DE_MKF_HOURS(DE_MKF_H_ZWEI, NO_WORD), DE_MKF_HOURS(DE_MKF_H_DREI, NO_WORD),
+    DE_MKF_HOURS(DE_MKF_H_VIER, NO_WORD), DE_MKF_HOURS(DE_MKF_H_FUENF, NO_WORD), DE_MKF_HOURS(DE_MKF_H_SECHS, NO_WORD), DE_MKF_HOURS(DE_MKF_H_SIEBEN, NO_WORD),
+    DE_MKF_HOURS(DE_MKF_H_ACHT, NO_WORD), DE_MKF_HOURS(DE_MKF_H_NEUN, NO_WORD), DE_MKF_HOURS(DE_MKF_H_ZEHN, NO_WORD), DE_MKF_HOURS(DE_MKF_H_ELF, NO_WORD)};
+
+static constexpr phrase_s phrasesDeMkfDe[12] PROGMEM = {
+    {{NO_WORD}, 0},                                  // Uhr
+    {{DE_MKF_FUENF, DE_MKF_NACH}, 0},                // 5 nach
+    {{DE_MKF_ZEHN, DE_MKF_NACH}, 0},                 // 10 nach
+    {{DE_MKF_VIERTEL, DE_MKF_NACH}, 0},              // viertel nach
+    {{DE_MKF_ZWANZIG, DE_MKF_NACH}, 0},              // 20 nach
+    {{DE_MKF_FUENF, DE_MKF_VOR, DE_MKF_HALB}, 1},    // 5 vor halb
+    {{DE_MKF_HALB}, 1},                              // halb
+    {{DE_MKF_FUENF, DE_MKF_NACH, DE_MKF_HALB}, 1},   // 5 nach halb
+    {{DE_MKF_ZWANZIG, DE_MKF_VOR}, 1},               // 20 vor
+    {{DE_MKF_VIERTEL, DE_MKF_VOR}, 1},               // viertel vor
+    {{DE_MKF_ZEHN, DE_MKF_VOR}, 1},                  // 10 vor
+    {{DE_MKF_FUENF, DE_MKF_VOR}, 1}};                // 5 vor
+
+static constexpr phrase_s phrasesDeMkfSw[12] PROGMEM = {
+    {{NO_WORD}, 0},                                  // Uhr
+    {{DE_MKF_FUENF, DE_MKF_NACH}, 0},                // 5 nach
+    {{DE_MKF_ZEHN, DE_MKF_NACH}, 0},                 // 10 nach
+    {{DE_MKF_VIERTEL}, 1},                           // viertel
+    {{DE_MKF_ZWANZIG, DE_MKF_NACH}, 0},              // 20 nach
+    {{DE_MKF_FUENF, DE_MKF_VOR, DE_MKF_HALB}, 1},    // 5 vor halb
+    {{DE_MKF_HALB}, 1},                              // halb
+    {{DE_MKF_FUENF, DE_MKF_NACH, DE_MKF_HALB}, 1},   // 5 nach halb
+    {{DE_MKF_ZWANZIG, DE_MKF_VOR}, 1},               // 20 vor
+    {{DE_MKF_DREIVIERTEL}, 1},                       // dreiviertel
+    {{DE_MKF_ZEHN, DE_MKF_VOR}, 1},                  // 10 vor
+    {{DE_MKF_FUENF, DE_MKF_VOR}, 1}};                // 5 vor
+
+static constexpr phrase_s phrasesDeMkfBa[12] PROGMEM = {
+    {{NO_WORD}, 0},                                  // Uhr
+    {{DE_MKF_FUENF, DE_MKF_NACH}, 0},                // 5 nach
+    {{DE_MKF_ZEHN, DE_MKF_NACH}, 0},                 // 10 nach
+    {{DE_MKF_VIERTEL, DE_MKF_NACH}, 0},              // viertel nach
+    {{DE_MKF_ZWANZIG, DE_MKF_NACH}, 0},              // 20 nach
+    {{DE_MKF_FUENF, DE_MKF_VOR, DE_MKF_HALB}, 1},    // 5 vor halb
+    {{DE_MKF_HALB}, 1},                              // halb
+    {{DE_MKF_FUENF, DE_MKF_NACH, DE_MKF_HALB}, 1},   // 5 nach halb
+    {{DE_MKF_ZWANZIG, DE_MKF_VOR}, 1},               // 20 vor
+    {{DE_MKF_DREIVIERTEL}, 1},                       // dreiviertel
+    {{DE_MKF_ZEHN, DE_MKF_VOR}, 1},                  // 10 vor
+    {{DE_MKF_FUENF, DE_MKF_VOR}, 1}};                // 5 vor
+
+static constexpr phrase_s phrasesDeMkfSa[12] PROGMEM = {
+    {{NO_WORD}, 0},                                  // Uhr
+    {{DE_MKF_FUENF, DE_MKF_NACH}, 0},                // 5 nach
+    {{DE_MKF_ZEHN, DE_MKF_NACH}, 0},                 // 10 nach
+    {{DE_MKF_VIERTEL}, 1},                           // viertel
+    {{DE_MKF_ZEHN, DE_MKF_VOR, DE_MKF_HALB}, 1},     // 10 vor halb
+    {{DE_MKF_FUENF, DE_MKF_VOR, DE_MKF_HALB}, 1},    // 5 vor halb
+    {{DE_MKF_HALB}, 1},                              // halb
+    {{DE_MKF_FUENF, DE_MKF_NACH, DE_MKF_HALB}, 1},   // 5 nach halb
+    {{DE_MKF_ZEHN, DE_MKF_NACH, DE_MKF_HALB}, 1},    // 10 nach halb
+    {{DE_MKF_DREIVIERTEL}, 1},                       // dreiviertel
+    {{DE_MKF_ZEHN, DE_MKF_VOR}, 1},                  // 10 vor
+    {{DE_MKF_FUENF, DE_MKF_VOR}, 1}};                // 5 vor
+
+//*****************************************************************************
+// D3
+//*****************************************************************************
+
+static constexpr hour_s hoursD3[24] PROGMEM = {
+    {{D3_H_ZWOELFE}}, {{D3_H_OISE}}, {{D3_H_ZWOIE}}, {{D3_H_DREIE}}, {{D3_H_VIERE}}, {{D3_H_FUENFE}},
+    {{D3_H_SECHSE}}, {{D3_H_SIEBNE}}, {{D3_H_ACHTE}}, {{D3_H_NEUNE}}, {{D3_H_ZEHNE}}, {{D3_H_ELFE}},
+    {{D3_H_ZWOELFE}}, {{D3_H_OISE}}, {{D3_H_ZWOIE}}, {{D3_H_DREIE}}, {{D3_H_VIERE}}, {{D3_H_FUENFE}},
+    {{D3_H_SECHSE}}, {{D3_H_SIEBNE}}, {{D3_H_ACHTE}}, {{D3_H_NEUNE}}, {{D3_H_ZEHNE}}, {{D3_H_ELFE}}};
+
+static constexpr phrase_s phrasesD3[12] PROGMEM = {
+    {{NO_WORD}, 0},                      // glatte Stunde
+    {{D3_FUENF, D3_NACH}, 0},            // 5 nach
+    {{D3_ZEHN, D3_NACH}, 0},             // 10 nach
+    {{D3_VIERTL}, 1},                    // viertl
+    {{D3_ZEHN, D3_VOR, D3_HALB}, 1},     // 10 vor halb
+    {{D3_FUENF, D3_VOR, D3_HALB}, 1},    // 5 vor halb
+    {{D3_HALB}, 1},                      // halb
+    {{D3_FUENF, D3_NACH, D3_HALB}, 1},   // 5 nach halb
+    {{D3_ZEHN, D3_NACH, D3_HALB}, 1},    // 10 nach halb
+    {{D3_DREIVIERTL}, 1},                // dreiviertl
+    {{D3_ZEHN, D3_VOR}, 1},              // 10 vor
+    {{D3_FUENF, D3_VOR}, 1}};            // 5 vor
+
+//*****************************************************************************
+// CH
+//*****************************************************************************
+
+static constexpr hour_s hoursCh[24] PROGMEM = {
+    {{CH_H_ZWOEUFI}}, {{CH_H_EIS}}, {{CH_H_ZWOEI}}, {{CH_H_DRUE}}, {{CH_H_VIER}}, {{CH_H_FUEFI}},
+    {{CH_H_SAECHSI}}, {{CH_H_SIEBNI}}, {{CH_H_ACHTI}}, {{CH_H_NUENI}}, {{CH_H_ZAENI}}, {{CH_H_EUFI}},
+    {{CH_H_ZWOEUFI}}, {{CH_H_EIS}}, {{CH_H_ZWOEI}}, {{CH_H_DRUE}}, {{CH_H_VIER}}, {{CH_H_FUEFI}},
+    {{CH_H_SAECHSI}}, {{CH_H_SIEBNI}}, {{CH_H_ACHTI}}, {{CH_H_NUENI}}, {{CH_H_ZAENI}}, {{CH_H_EUFI}}};
+
+static constexpr phrase_s phrasesCh[12] PROGMEM = {
+    {{NO_WORD}, 0},                      // glatte Stunde
+    {{CH_FUEF, CH_AB}, 0},               // 5 ab
+    {{CH_ZAEAE, CH_AB}, 0},              // 10 ab
+    {{CH_VIERTU, CH_AB}, 0},             // viertel ab
+    {{CH_ZWAENZG, CH_AB}, 0},            // 20 ab
+    {{CH_FUEF, CH_VOR, CH_HAUBI}, 1},    // 5 vor halb
+    {{CH_HAUBI}, 1},                     // halb
+    {{CH_FUEF, CH_AB, CH_HAUBI}, 1},     // 5 ab halb
+    {{CH_ZWAENZG, CH_VOR}, 1},           // 20 vor
+    {{CH_VIERTU, CH_VOR}, 1},            // viertel vor
+    {{CH_ZAEAE, CH_VOR}, 1},             // 10 vor
+    {{CH_FUEF, CH_VOR}, 1}};             // 5 vor
+
+//*****************************************************************************
+// EN
+//*****************************************************************************
+
+static constexpr hour_s hoursEn[24] PROGMEM = {
+    {{EN_H_TWELVE}}, {{EN_H_ONE}}, {{EN_H_TWO}}, {{EN_H_THREE}}, {{EN_H_FOUR}}, {{EN_H_FIVE}},
+    {{EN_H_SIX}}, {{EN_H_SEVEN}}, {{EN_H_EIGHT}}, {{EN_H_NINE}}, {{EN_H_TEN}}, {{EN_H_ELEVEN}},
+    {{EN_H_TWELVE}}, {{EN_H_ONE}}, {{EN_H_TWO}}, {{EN_H_THREE}}, {{EN_H_FOUR}}, {{EN_H_FIVE}},
+    {{EN_H_SIX}}, {{EN_H_SEVEN}}, {{EN_H_EIGHT}}, {{EN_H_NINE}}, {{EN_H_TEN}}, {{EN_H_ELEVEN}}};
+
+static constexpr phrase_s phrasesEn[12] PROGMEM = {
+    {{NO_WORD}, 0},                      // o'clock
+    {{EN_FIVE, EN_PAST}, 0},             // five past
+    {{EN_TEN, EN_PAST}, 0},              // ten past
+    {{EN_A, EN_QUATER, EN_PAST}, 0},     // a quarter past
+    {{EN_TWENTY, EN_PAST}, 0},           // twenty past
+    {{EN_TWENTY, EN_FIVE, EN_PAST}, 0},  // twenty five past
+    {{EN_HALF, EN_PAST}, 0},             // half past
+    {{EN_TWENTY, EN_FIVE, EN_TO}, 1},    // twenty five to
+    {{EN_TWENTY, EN_TO}, 1},             // twenty to
+    {{EN_A, EN_QUATER, EN_TO}, 1},       // a quarter to
+    {{EN_TEN, EN_TO}, 1},                // ten to
+    {{EN_FIVE, EN_TO}, 1}};              // five to
+
+//*****************************************************************************
+// ES
+//*****************************************************************************
+
+static constexpr hour_s hoursEs[24] PROGMEM = {
+    {{ES_H_DOCE, ES_SONLAS}}, {{ES_H_UNA, ES_ESLA}}, {{ES_H_DOS, ES_SONLAS}}, {{ES_H_TRES, ES_SONLAS}},
+    {{ES_H_CUATRO, ES_SONLAS}}, {{ES_H_CINCO, ES_SONLAS}}, {{ES_H_SEIS, ES_SONLAS}}, {{ES_H_SIETE, ES_SONLAS}},
+    {{ES_H_OCHO, ES_SONLAS}}, {{ES_H_NUEVE, ES_SONLAS}}, {{ES_H_DIEZ, ES_SONLAS}}, {{ES_H_ONCE, ES_SONLAS}},
+    {{ES_H_DOCE, ES_SONLAS}}, {{ES_H_UNA, ES_ESLA}}, {{ES_H_DOS, ES_SONLAS}}, {{ES_H_TRES, ES_SONLAS}},
+    {{ES_H_CUATRO, ES_SONLAS}}, {{ES_H_CINCO, ES_SONLAS}}, {{ES_H_SEIS, ES_SONLAS}}, {{ES_H_SIETE, ES_SONLAS}},
+    {{ES_H_OCHO, ES_SONLAS}}, {{ES_H_NUEVE, ES_SONLAS}}, {{ES_H_DIEZ, ES_SONLAS}}, {{ES_H_ONCE, ES_SONLAS}}};
+
+static constexpr phrase_s phrasesEs[12] PROGMEM = {
+    {{NO_WORD}, 0},                      // en punto
+    {{ES_Y, ES_CINCO}, 0},               // y cinco
+    {{ES_Y, ES_DIEZ}, 0},                // y diez
+    {{ES_Y, ES_CUARTO}, 0},              // y cuarto
+    {{ES_Y, ES_VEINTE}, 0},              // y veinte
+    {{ES_Y, ES_VEINTICINCO}, 0},         // y veinticinco
+    {{ES_Y, ES_MEDIA}, 0},               // y media
+    {{ES_MENOS, ES_VEINTICINCO}, 1},     // menos veinticinco
+    {{ES_MENOS, ES_VEINTE}, 1},          // menos veinte
+    {{ES_MENOS, ES_CUARTO}, 1},          // menos cuarto
+    {{ES_MENOS, ES_DIEZ}, 1},            // menos diez
+    {{ES_MENOS, ES_CINCO}, 1}};          // menos cinco
+
+//*****************************************************************************
+// FR
+//*****************************************************************************
+
+static constexpr hour_s hoursFr[24] PROGMEM = {
+    {{FR_H_MINUIT}}, {{FR_H_UNE, FR_HEURE}}, {{FR_H_DEUX, FR_HEURES}}, {{FR_H_TROIS, FR_HEURES}},
+    {{FR_H_QUATRE, FR_HEURES}}, {{FR_H_CINQ, FR_HEURES}}, {{FR_H_SIX, FR_HEURES}}, {{FR_H_SEPT, FR_HEURES}},
+    {{FR_H_HUIT, FR_HEURES}}, {{FR_H_NEUF, FR_HEURES}}, {{FR_H_DIX, FR_HEURES}}, {{FR_H_ONZE, FR_HEURES}},
+    {{FR_H_MIDI}}, {{FR_H_UNE, FR_HEURE}}, {{FR_H_DEUX, FR_HEURES}}, {{FR_H_TROIS, FR_HEURES}},
+    {{FR_H_QUATRE, FR_HEURES}}, {{FR_H_CINQ, FR_HEURES}}, {{FR_H_SIX, FR_HEURES}}, {{FR_H_SEPT, FR_HEURES}},
+    {{FR_H_HUIT, FR_HEURES}}, {{FR_H_NEUF, FR_HEURES}}, {{FR_H_DIX, FR_HEURES}}, {{FR_H_ONZE, FR_HEURES}}};
+
+static constexpr phrase_s phrasesFr[12] PROGMEM = {
+    {{NO_WORD}, 0},                                  // heures
+    {{FR_CINQ}, 0},                                  // cinq
+    {{FR_DIX}, 0},                                   // dix
+    {{FR_ET, FR_QUART}, 0},                          // et quart
+    {{FR_VINGT}, 0},                                 // vingt
+    {{FR_VINGT, FR_TRAIT, FR_CINQ}, 0},              // vingt-cinq
+    {{FR_ET, FR_DEMIE}, 0},                          // et demie
+    {{FR_MOINS, FR_VINGT, FR_TRAIT, FR_CINQ}, 1},    // moins vingt-cinq
+    {{FR_MOINS, FR_VINGT}, 1},                       // moins vingt
+    {{FR_MOINS, FR_LE, FR_QUART}, 1},                // moins le quart
+    {{FR_MOINS, FR_DIX}, 1},                         // moins dix
+    {{FR_MOINS, FR_CINQ}, 1}};                       // moins cinq
+
+//*****************************************************************************
+// IT
+//*****************************************************************************
+
+static constexpr hour_s hoursIt[24] PROGMEM = {
+    {{IT_H_DODICI, IT_SONOLE}}, {{IT_H_LUNA, IT_E}}, {{IT_H_DUE, IT_SONOLE}}, {{IT_H_TRE, IT_SONOLE}},
+    {{IT_H_QUATTRO, IT_SONOLE}}, {{IT_H_CINQUE, IT_SONOLE}}, {{IT_H_SEI, IT_SONOLE}}, {{IT_H_SETTE, IT_SONOLE}},
+    {{IT_H_OTTO, IT_SONOLE}}, {{IT_H_NOVE, IT_SONOLE}}, {{IT_H_DIECI, IT_SONOLE}}, {{IT_H_UNDICI, IT_SONOLE}},
+    {{IT_H_DODICI, IT_SONOLE}}, {{IT_H_LUNA, IT_E}}, {{IT_H_DUE, IT_SONOLE}}, {{IT_H_TRE, IT_SONOLE}},
+    {{IT_H_QUATTRO, IT_SONOLE}}, {{IT_H_CINQUE, IT_SONOLE}}, {{IT_H_SEI, IT_SONOLE}}, {{IT_H_SETTE, IT_SONOLE}},
+    {{IT_H_OTTO, IT_SONOLE}}, {{IT_H_NOVE, IT_SONOLE}}, {{IT_H_DIECI, IT_SONOLE}}, {{IT_H_UNDICI, IT_SONOLE}}};
+
+static constexpr phrase_s phrasesIt[12] PROGMEM = {
+    {{NO_WORD}, 0},                          // in punto
+    {{IT_E2, IT_CINQUE}, 0},                 // e cinque
+    {{IT_E2, IT_DIECI}, 0},                  // e dieci
+    {{IT_E2, IT_UN, IT_QUARTO}, 0},          // e un quarto
+    {{IT_E2, IT_VENTI}, 0},                  // e venti
+    {{IT_E2, IT_VENTI, IT_CINQUE}, 0},       // e venticinque
+    {{IT_E2, IT_MEZZA}, 0},                  // e mezza
+    {{IT_MENO, IT_VENTI, IT_CINQUE}, 1},     // meno venticinque
+    {{IT_MENO, IT_VENTI}, 1},                // meno venti
+    {{IT_MENO, IT_UN, IT_QUARTO}, 1},        // meno un quarto
+    {{IT_MENO, IT_DIECI}, 1},                // meno dieci
+    {{IT_MENO, IT_CINQUE}, 1}};              // meno cinque
+
+//*****************************************************************************
+// NL
+//*****************************************************************************
+
+static constexpr hour_s hoursNl[24] PROGMEM = {
+    {{NL_H_TWAALF}}, {{NL_H_EEN}}, {{NL_H_TWEE}}, {{NL_H_DRIE}}, {{NL_H_VIER}}, {{NL_H_VIJF}},
+    {{NL_H_ZES}}, {{NL_H_ZEVEN}}, {{NL_H_ACHT}}, {{NL_H_NEGEN}}, {{NL_H_TIEN}}, {{NL_H_ELF}},
+    {{NL_H_TWAALF}}, {{NL_H_EEN}}, {{NL_H_TWEE}}, {{NL_H_DRIE}}, {{NL_H_VIER}}, {{NL_H_VIJF}},
+    {{NL_H_ZES}}, {{NL_H_ZEVEN}}, {{NL_H_ACHT}}, {{NL_H_NEGEN}}, {{NL_H_TIEN}}, {{NL_H_ELF}}};
+
+static constexpr phrase_s phrasesNl[12] PROGMEM = {
+    {{NO_WORD}, 0},                      // uur
+    {{NL_VIJF, NL_OVER}, 0},             // vijf over
+    {{NL_TIEN, NL_OVER}, 0},             // tien over
+    {{NL_KWART, NL_OVER2}, 0},           // kwart over
+    {{NL_TIEN, NL_VOOR, NL_HALF}, 1},    // tien voor half
+    {{NL_VIJF, NL_VOOR, NL_HALF}, 1},    // vijf voor half
+    {{NL_HALF}, 1},                      // half
+    {{NL_VIJF, NL_OVER, NL_HALF}, 1},    // vijf over half
+    {{NL_TIEN, NL_OVER, NL_HALF}, 1},    // tien over half
+    {{NL_KWART, NL_VOOR2}, 1},           // kwart voor
+    {{NL_TIEN, NL_VOOR}, 1},             // tien voor
+    {{NL_VIJF, NL_VOOR}, 1}};            // vijf voor
+
+//*****************************************************************************
+// Front covers
+//*****************************************************************************
+
+static constexpr char weekdaysEn[] PROGMEM = "SUMOTUWETHFRSA";
+static constexpr char weekdaysDe[] PROGMEM = "SOMODIMIDOFRSA";
+static constexpr char weekdaysEs[] PROGMEM = "DOLUMAMIJUVISA";
+static constexpr char weekdaysFr[] PROGMEM = "DILUMAMEJEVESA";
+static constexpr char weekdaysIt[] PROGMEM = "DOLUMAMEGIVESA";
+static constexpr char weekdaysNl[] PROGMEM = "ZOMADIWODOVRZA";
+
+// In the order of eFrontCover.
+static constexpr frontCover_s frontCovers[COVER_COUNT] PROGMEM = {
+    {"EN", EN_ITIS, {EN_ITIS, NO_WORD}, EN_OCLOCK, NO_WORD, EN_AM, EN_PM, phrasesEn, hoursEn, weekdaysEn},
+    {"DE", DE_ESIST, {DE_ESIST, NO_WORD}, DE_UHR, NO_WORD, DE_AM, DE_PM, phrasesDeDe, hoursDe, weekdaysDe},
+    {"DE SW", DE_ESIST, {DE_ESIST, NO_WORD}, DE_UHR, NO_WORD, DE_AM, DE_PM, phrasesDeSw, hoursDe, weekdaysDe},
+    {"DE BA", DE_ESIST, {DE_ESIST, NO_WORD}, DE_UHR, NO_WORD, DE_AM, DE_PM, phrasesDeBa, hoursDe, weekdaysDe},
+    {"DE SA", DE_ESIST, {DE_ESIST, NO_WORD}, DE_UHR, NO_WORD, DE_AM, DE_PM, phrasesDeSa, hoursDe, weekdaysDe},
+    {"DE MKF", DE_MKF_ESIST, {DE_MKF_ESIST, NO_WORD}, DE_MKF_UHR, NO_WORD, DE_MKF_AM, DE_MKF_PM, phrasesDeMkfDe, hoursDeMkf, weekdaysDe},
+    {"DE MKF SW", DE_MKF_ESIST, {DE_MKF_ESIST, NO_WORD}, DE_MKF_UHR, NO_WORD, DE_MKF_AM, DE_MKF_PM, phrasesDeMkfSw, hoursDeMkf, weekdaysDe},
+    {"DE MKF BA", DE_MKF_ESIST, {DE_MKF_ESIST, NO_WORD}, DE_MKF_UHR, NO_WORD, DE_MKF_AM, DE_MKF_PM, phrasesDeMkfBa, hoursDeMkf, weekdaysDe},
+    {"DE MKF SA", DE_MKF_ESIST, {DE_MKF_ESIST, NO_WORD}, DE_MKF_UHR, NO_WORD, DE_MKF_AM, DE_MKF_PM, phrasesDeMkfSa, hoursDeMkf, weekdaysDe},
+    {"D3", D3_ESISCH, {D3_ESISCH, NO_WORD}, NO_WORD, NO_WORD, D3_AM, D3_PM, phrasesD3, hoursD3, weekdaysDe},
+    {"CH", CH_ESISCH, {CH_ESISCH, NO_WORD}, NO_WORD, NO_WORD, CH_AM, CH_PM, phrasesCh, hoursCh, weekdaysDe},
+    {"CH GS", CH_ESISCH, {CH_ESISCH, NO_WORD}, NO_WORD, CH_GSI, CH_AM, CH_PM, phrasesCh, hoursCh, weekdaysDe},
+    {"ES", NO_WORD, {ES_SONLAS, ES_ESLA}, NO_WORD, NO_WORD, ES_AM, ES_PM, phrasesEs, hoursEs, weekdaysEs},
+    {"FR", FR_ILEST, {FR_ILEST, NO_WORD}, NO_WORD, NO_WORD, FR_AM, FR_PM, phrasesFr, hoursFr, weekdaysFr},
+    {"IT", NO_WORD, {IT_SONOLE, IT_E}, NO_WORD, NO_WORD, IT_AM, IT_PM, phrasesIt, hoursIt, weekdaysIt},
+    {"NL", NL_HETIS, {NL_HETIS, NO_WORD}, NL_UUR, NO_WORD, NL_AM, NL_PM, phrasesNl, hoursNl, weekdaysNl}};
+
+//*****************************************************************************
+// Frame cache
+//*****************************************************************************
+
+// The words of the time, without the words between the five minutes.
+// Reads the tables directly, so the compiler has to evaluate it.
+constexpr void buildFrame(const frontCover_s &cover, uint8_t hours, uint8_t slot, uint16_t frame[])
+{
+    uint16_t words[8] = {cover.intro};
+    uint8_t count = 1;
+    const phrase_s &phrase = cover.phrases[slot];
+    for (uint16_t word : phrase.words)
+        words[count++] = word;
+    const hour_s &hour = cover.hours[(hours + phrase.nextHour) % 24];
+    words[count++] = ((slot == 0) && hour.fullHour) ? hour.fullHour : hour.words[0];
+    words[count++] = hour.words[1];
+    if (slot == 0)
+        words[count++] = cover.fullHour;
+    for (uint8_t i = 0; i < count; i++)
+        frame[words[i] & 0x000F] |= words[i] & 0xFFE0;
+}
+
+// Most covers say the same at 1 and 13 o'clock.
+constexpr boolean hoursRepeat(const frontCover_s &cover)
+{
+    for (uint8_t i = 0; i < 12; i++)
+    {
+        const hour_s &am = cover.hours[i];
+        const hour_s &pm = cover.hours[i + 12];
+        if ((am.words[0] != pm.words[0]) || (am.words[1] != pm.words[1]) || (am.fullHour != pm.fullHour))
+            return false;
+    }
+    return true;
+}
+
+// One frame for every five minutes of 12 (FR: 24) hours.
+template <uint8_t HOURS>
+struct frameCache_s
+{
+    uint16_t frames[HOURS * 12][10];
+};
+
+template <uint8_t HOURS>
+constexpr frameCache_s<HOURS> buildFrameCache(const frontCover_s &cover)
+{
+    frameCache_s<HOURS> cache = {};
+    for (uint8_t hours = 0; hours < HOURS; hours++)
+        for (uint8_t slot = 0; slot < 12; slot++)
+            buildFrame(cover, hours, slot, cache.frames[hours * 12 + slot]);
+    return cache;
+}
+
+#define FRAME_CACHE(cover) buildFrameCache<hoursRepeat(frontCovers[cover]) ? 12 : 24>(frontCovers[cover])
+
+static constexpr auto framesEn PROGMEM = FRAME_CACHE(COVER_EN);
+static constexpr auto framesDeDe PROGMEM = FRAME_CACHE(COVER_DE_DE);
+static constexpr auto framesDeSw PROGMEM = FRAME_CACHE(COVER_DE_SW);
+static constexpr auto framesDeBa PROGMEM = FRAME_CACHE(COVER_DE_BA);
+static constexpr auto framesDeSa PROGMEM = FRAME_CACHE(COVER_DE_SA);
+static constexpr auto framesDeMkfDe PROGMEM = FRAME_CACHE(COVER_DE_MKF_DE);
+static constexpr auto framesDeMkfSw PROGMEM = FRAME_CACHE(COVER_DE_MKF_SW);
+static constexpr auto framesDeMkfBa PROGMEM = FRAME_CACHE(COVER_DE_MKF_BA);
+static constexpr auto framesDeMkfSa PROGMEM = FRAME_CACHE(COVER_DE_MKF_SA);
+static constexpr auto framesD3 PROGMEM = FRAME_CACHE(COVER_D3);
+static constexpr auto framesCh PROGMEM = FRAME_CACHE(COVER_CH);
+static constexpr auto framesChGs PROGMEM = FRAME_CACHE(COVER_CH_GS);
+static constexpr auto framesEs PROGMEM = FRAME_CACHE(COVER_ES);
+static constexpr auto framesFr PROGMEM = FRAME_CACHE(COVER_FR);
+static constexpr auto framesIt PROGMEM = FRAME_CACHE(COVER_IT);
+static constexpr auto framesNl PROGMEM = FRAME_CACHE(COVER_NL);
+
+// The frame cache of a front cover.
+struct frames_s
+{
+    const uint16_t (*frames)[10];
+    uint8_t hours; // 12 or 24
+    uint16_t size; // Bytes
+};
+
+// All covers are built in, the frames take the most flash. Keep them below this.
+#define FRONTCOVER_FLASH_BUDGET 65536
+
+#define FRAMES(cache) {cache.frames, sizeof(cache.frames) / sizeof(cache.frames[0]) / 12, sizeof(cache)}
+
+// In the order of eFrontCover.
+static constexpr frames_s frameCaches[COVER_COUNT] PROGMEM = {
+    FRAMES(framesEn),
+    FRAMES(framesDeDe),
+    FRAMES(framesDeSw),
+    FRAMES(framesDeBa),
+    FRAMES(framesDeSa),
+    FRAMES(framesDeMkfDe),
+    FRAMES(framesDeMkfSw),
+    FRAMES(framesDeMkfBa),
+    FRAMES(framesDeMkfSa),
+    FRAMES(framesD3),
+    FRAMES(framesCh),
+    FRAMES(framesChGs),
+    FRAMES(framesEs),
+    FRAMES(framesFr),
+    FRAMES(framesIt),
+    FRAMES(framesNl)};
+
+constexpr uint32_t frameCacheBytes()
+{
+    uint32_t bytes = 0;
+    for (const frames_s &cache : frameCaches)
+        bytes += cache.size;
+    return bytes;
+}
+
+static_assert(frameCacheBytes() <= FRONTCOVER_FLASH_BUDGET, "The frame caches take too much flash");
@@ -0,0 +1,511 @@
+#pragma once
+
+#include "Font.h"
+
+// Glyphs of the fonts, sorted by codepoint. One byte per column, bit 0 is the top row.
+
+// 7 rows: ASCII, Latin-1 and the euro sign
+
+static const uint8_t fontBigColumns[] PROGMEM = {
+    0x00, 0x00, 0x00, // space
+    0x5f, // !
+    0x07, 0x00, 0x07, // "
+    0x14, 0x7f, 0x14, 0x7f, 0x14, // #
+    0x24, 0x2a, 0x7f, 0x2a, 0x12, // $
+    0x23, 0x13, 0x08, 0x64, 0x62, // %
+    0x36, 0x49, 0x55, 0x22, 0x50, // &
+    0x05, 0x03, // '
+    0x1c, 0x22, 0x41, // (
+    0x41, 0x22, 0x1c, // )
+    0x14, 0x08, 0x3e, 0x08, 0x14, // *
+    0x08, 0x08, 0x3e, 0x08, 0x08, // +
+    0x50, 0x30, // ,
+    0x08, 0x08, 0x08, 0x08, 0x08, // -
+    0x40, // .
+    0x20, 0x10, 0x08, 0x04, 0x02, // /
+#ifdef NONE_TECHNICAL_ZERO
+    0x3e, 0x41, 0x41, 0x41, 0x3e, // 0
+#else
+    0x3e, 0x51, 0x49, 0x45, 0x3e, // 0
+#endif
+    0x42, 0x7f, 0x40, // 1
+    0x42, 0x61, 0x51, 0x49, 0x46, // 2
+    0x21, 0x41, 0x45, 0x4b, 0x31, // 3
+    0x18, 0x14, 0x12, 0x7f, 0x10, // 4
+    0x27, 0x45, 0x45, 0x45, 0x39, // 5
+    0x3c, 0x4a, 0x49, 0x49, 0x30, // 6
+    0x01, 0x71, 0x09, 0x05, 0x03, // 7
+    0x36, 0x49, 0x49, 0x49, 0x36, // 8
+    0x06, 0x49, 0x49, 0x29, 0x1e, // 9
+    0x24, // :
+    0x56, 0x36, // ;
+    0x08, 0x14, 0x22, 0x41, // <
+    0x14, 0x14, 0x14, 0x14, 0x14, // =
+    0x41, 0x22, 0x14, 0x08, // >
+    0x02, 0x01, 0x51, 0x09, 0x06, // ?
+    0x32, 0x49, 0x79, 0x41, 0x3e, // @
+    0x7e, 0x09, 0x09, 0x09, 0x7e, // A
+    0x7f, 0x49, 0x49, 0x49, 0x36, // B
+    0x3e, 0x41, 0x41, 0x41, 0x22, // C
+    0x7f, 0x41, 0x41, 0x22, 0x1c, // D
+    0x7f, 0x49, 0x49, 0x49, 0x41, // E
+    0x7f, 0x09, 0x09, 0x09, 0x01, // F
+    0x3e, 0x41, 0x49, 0x49, 0x32, // G
+    0x7f, 0x08, 0x08, 0x08, 0x7f, // H
+    0x41, 0x7f, 0x41, // I
+    0x20, 0x40, 0x41, 0x3f, 0x01, // J
+    0x7f, 0x08, 0x14, 0x22, 0x41, // K
+    0x7f, 0x40, 0x40, 0x40, 0x40, // L
+    0x7f, 0x02, 0x0c, 0x02, 0x7f, // M
+    0x7f, 0x04, 0x08, 0x10, 0x7f, // N
+    0x3e, 0x41, 0x41, 0x41, 0x3e, // O
+    0x7f, 0x09, 0x09, 0x09, 0x06, // P
+    0x3e, 0x41, 0x51, 0x21, 0x5e, // Q
+    0x7f, 0x09, 0x19, 0x29, 0x46, // R
+    0x26, 0x49, 0x49, 0x49, 0x32, // S
+    0x01, 0x01, 0x7f, 0x01, 0x01, // T
+    0x3f, 0x40, 0x40, 0x40, 0x3f, // U
+    0x1f, 0x20, 0x40, 0x20, 0x1f, // V
+    0x3f, 0x40, 0x38, 0x40, 0x3f, // W
+    0x63, 0x14, 0x08, 0x14, 0x63, // X
+    0x07, 0x08, 0x70, 0x08, 0x07, // Y
+    0x61, 0x51, 0x49, 0x45, 0x43, // Z
+    0x7f, 0x41, 0x41, // [
+    0x02, 0x04, 0x08, 0x10, 0x20, // backslash
+    0x41, 0x41, 0x7f, // ]
+    0x04, 0x02, 0x01, 0x02, 0x04, // ^
+    0x40, 0x40, 0x40, 0x40, 0x40, // _
+    0x01, 0x02, 0x04, // `
+    0x20, 0x54, 0x54, 0x54, 0x78, // a
+    0x7f, 0x50, 0x48, 0x48, 0x30, // b
+    0x38, 0x44, 0x44, 0x44, 0x20, // c
+    0x30, 0x48, 0x48, 0x50, 0x7f, // d
+    0x38, 0x54, 0x54, 0x54, 0x18, // e
+    0x08, 0x7e, 0x09, 0x01, 0x02, // f
+    0x0c, 0x52, 0x52, 0x52, 0x3e, // g
+    0x7f, 0x08, 0x04, 0x04, 0x78, // h
+    0x7a, // i
+    0x20, 0x40, 0x44, 0x3d, // j
+    0x7f, 0x10, 0x28, 0x44, // k
+    0x41, 0x7f, 0x40, // l
+    0x7c, 0x04, 0x18, 0x04, 0x78, // m
+    0x7c, 0x08, 0x04, 0x04, 0x78, // n
+    0x38, 0x44, 0x44, 0x44, 0x38, // o
+    0x7c, 0x14, 0x14, 0x14, 0x08, // p
+    0x08, 0x14, 0x14, 0x18, 0x7c, // q
+    0x7c, 0x08, 0x04, 0x04, 0x08, // r
+    0x48, 0x54, 0x54, 0x54, 0x20, // s
+    0x04, 0x3f, 0x44, 0x40, // t
+    0x3c, 0x40, 0x40, 0x20, 0x7c, // u
+    0x1c, 0x20, 0x40, 0x20, 0x1c, // v
+    0x3c, 0x40, 0x30, 0x40, 0x3c, // w
+    0x44, 0x28, 0x10, 0x28, 0x44, // x
+    0x0c, 0x50, 0x50, 0x50, 0x3c, // y
+    0x44, 0x64, 0x54, 0x4c, 0x44, // z
+    0x08, 0x36, 0x41, // {
+    0x7f, // |
+    0x41, 0x36, 0x08, // }
+    0x10, 0x08, 0x18, 0x10, 0x08, // ~
+    0x00, 0x00, 0x00, // no-break space
+    0x7d, // ¡
+    0x1c, 0x22, 0x7f, 0x22, 0x14, // ¢
+    0x48, 0x3e, 0x49, 0x49, 0x22, // £
+    0x22, 0x1c, 0x14, 0x1c, 0x22, // ¤
+    0x15, 0x16, 0x7c, 0x16, 0x15, // ¥
+    0x77, // ¦
+    0x0a, 0x55, 0x55, 0x55, 0x28, // §
+    0x01, 0x00, 0x01, // ¨
+    0x3e, 0x49, 0x55, 0x55, 0x3e, // ©
+    0x48, 0x55, 0x55, 0x55, 0x5e, // ª
+    0x08, 0x14, 0x2a, 0x14, 0x22, // «
+    0x04, 0x04, 0x04, 0x04, 0x1c, // ¬
+    0x08, 0x08, 0x08, // soft hyphen
+    0x3e, 0x7d, 0x55, 0x69, 0x3e, // ®
+    0x01, 0x01, 0x01, 0x01, 0x01, // ¯
+    0x06, 0x09, 0x09, 0x06, // °
+    0x44, 0x44, 0x5f, 0x44, 0x44, // ±
+    0x19, 0x15, 0x12, // ²
+    0x15, 0x15, 0x0a, // ³
+    0x02, 0x01, // ´
+    0x7c, 0x20, 0x20, 0x10, 0x3c, // µ
+    0x06, 0x0f, 0x7f, 0x01, 0x7f, // ¶
+    0x08, // ·
+    0x40, 0x20, // ¸
+    0x12, 0x1f, 0x10, // ¹
+    0x4e, 0x51, 0x51, 0x51, 0x4e, // º
+    0x22, 0x14, 0x2a, 0x14, 0x08, // »
+    0x17, 0x08, 0x34, 0x2a, 0x79, // ¼
+    0x17, 0x08, 0x4c, 0x6a, 0x51, // ½
+    0x15, 0x0f, 0x34, 0x2a, 0x79, // ¾
+    0x30, 0x48, 0x45, 0x40, 0x20, // ¿
+    0x78, 0x15, 0x16, 0x78, // À
+    0x78, 0x16, 0x15, 0x78, // Á
+    0x7a, 0x15, 0x15, 0x7a, // Â
+    0x7a, 0x15, 0x16, 0x79, // Ã
+    0x79, 0x14, 0x14, 0x79, // Ä
+    0x78, 0x17, 0x17, 0x78, // Å
+    0x7e, 0x09, 0x7f, 0x49, 0x49, // Æ
+    0x1e, 0x21, 0x61, 0x21, 0x12, // Ç
+    0x7c, 0x55, 0x56, 0x44, // È
+    0x7c, 0x56, 0x55, 0x44, // É
+    0x7e, 0x55, 0x55, 0x46, // Ê
+    0x7d, 0x54, 0x54, 0x45, // Ë
+    0x45, 0x7e, 0x44, // Ì
+    0x44, 0x7e, 0x45, // Í
+    0x46, 0x7d, 0x46, // Î
+    0x45, 0x7c, 0x45, // Ï
+    0x7f, 0x49, 0x49, 0x22, 0x1c, // Ð
+    0x7e, 0x09, 0x13, 0x22, 0x7d, // Ñ
+    0x7c, 0x45, 0x46, 0x7c, // Ò
+    0x7c, 0x46, 0x45, 0x7c, // Ó
+    0x7e, 0x45, 0x45, 0x7e, // Ô
+    0x7e, 0x45, 0x46, 0x7d, // Õ
+    0x7d, 0x44, 0x44, 0x7d, // Ö
+    0x22, 0x14, 0x08, 0x14, 0x22, // ×
+    0x7e, 0x61, 0x5d, 0x43, 0x3f, // Ø
+    0x3c, 0x41, 0x42, 0x40, 0x3c, // Ù
+    0x3c, 0x40, 0x42, 0x41, 0x3c, // Ú
+    0x3c, 0x42, 0x41, 0x42, 0x3c, // Û
+    0x3c, 0x41, 0x40, 0x41, 0x3c, // Ü
+    0x04, 0x08, 0x72, 0x09, 0x04, // Ý
+    0x7f, 0x12, 0x12, 0x12, 0x0c, // Þ
+    0x7e, 0x01, 0x49, 0x4e, 0x30, // ß
+    0x20, 0x55, 0x56, 0x54, 0x78, // à
+    0x20, 0x54, 0x56, 0x55, 0x78, // á
+    0x20, 0x56, 0x55, 0x56, 0x78, // â
+    0x22, 0x55, 0x57, 0x56, 0x79, // ã
+    0x20, 0x55, 0x54, 0x55, 0x78, // ä
+    0x20, 0x57, 0x55, 0x57, 0x78, // å
+    0x74, 0x54, 0x38, 0x54, 0x58, // æ
+    0x1c, 0x22, 0x62, 0x22, 0x10, // ç
+    0x38, 0x55, 0x56, 0x54, 0x18, // è
+    0x38, 0x54, 0x56, 0x55, 0x18, // é
+    0x38, 0x56, 0x55, 0x56, 0x18, // ê
+    0x38, 0x55, 0x54, 0x55, 0x18, // ë
+    0x01, 0x7a, // ì
+    0x7a, 0x01, // í
+    0x02, 0x79, 0x02, // î
+    0x01, 0x78, 0x01, // ï
+    0x20, 0x55, 0x52, 0x55, 0x38, // ð
+    0x7e, 0x09, 0x07, 0x06, 0x79, // ñ
+    0x38, 0x45, 0x46, 0x44, 0x38, // ò
+    0x38, 0x44, 0x46, 0x45, 0x38, // ó
+    0x38, 0x46, 0x45, 0x46, 0x38, // ô
+    0x3a, 0x45, 0x47, 0x46, 0x39, // õ
+    0x38, 0x45, 0x44, 0x45, 0x38, // ö
+    0x08, 0x08, 0x2a, 0x08, 0x08, // ÷
+    0x78, 0x64, 0x54, 0x4c, 0x3c, // ø
+    0x3c, 0x41, 0x42, 0x20, 0x7c, // ù
+    0x3c, 0x40, 0x42, 0x21, 0x7c, // ú
+    0x3c, 0x42, 0x41, 0x22, 0x7c, // û
+    0x3c, 0x41, 0x40, 0x21, 0x7c, // ü
+    0x0c, 0x50, 0x52, 0x51, 0x3c, // ý
+    0x7f, 0x14, 0x14, 0x14, 0x08, // þ
+    0x0c, 0x51, 0x50, 0x51, 0x3c, // ÿ
+    0x14, 0x3e, 0x55, 0x55, 0x22  // €
+};
+
+static const glyph_s fontBigGlyphs[] PROGMEM = {
+    {0x0020, 0, 3}, // space
+    {0x0021, 3, 1}, // !
+    {0x0022, 4, 3}, // "
+    {0x0023, 7, 5}, // #
+    {0x0024, 12, 5}, // $
+    {0x0025, 17, 5}, // %
+    {0x0026, 22, 5}, // &
+    {0x0027, 27, 2}, // '
+    {0x0028, 29, 3}, // (
+    {0x0029, 32, 3}, // )
+    {0x002A, 35, 5}, // *
+    {0x002B, 40, 5}, // +
+    {0x002C, 45, 2}, // ,
+    {0x002D, 47, 5}, // -
+    {0x002E, 52, 1}, // .
+    {0x002F, 53, 5}, // /
+    {0x0030, 58, 5}, // 0
+    {0x0031, 63, 3}, // 1
+    {0x0032, 66, 5}, // 2
+    {0x0033, 71, 5}, // 3
+    {0x0034, 76, 5}, // 4
+    {0x0035, 81, 5}, // 5
+    {0x0036, 86, 5}, // 6
+    {0x0037, 91, 5}, // 7
+    {0x0038, 96, 5}, // 8
+    {0x0039, 101, 5}, // 9
+    {0x003A, 106, 1}, // :
+    {0x003B, 107, 2}, // ;
+    {0x003C, 109, 4}, // <
+    {0x003D, 113, 5}, // =
+    {0x003E, 118, 4}, // >
+    {0x003F, 122, 5}, // ?
+    {0x0040, 127, 5}, // @
+    {0x0041, 132, 5}, // A
+    {0x0042, 137, 5}, // B
+    {0x0043, 142, 5}, // C
+    {0x0044, 147, 5}, // D
+    {0x0045, 152, 5}, // E
+    {0x0046, 157, 5}, // F
+    {0x0047, 162, 5}, // G
+    {0x0048, 167, 5}, // H
+    {0x0049, 172, 3}, // I
+    {0x004A, 175, 5}, // J
+    {0x004B, 180, 5}, // K
+    {0x004C, 185, 5}, // L
+    {0x004D, 190, 5}, // M
+    {0x004E, 195, 5}, // N
+    {0x004F, 200, 5}, // O
+    {0x0050, 205, 5}, // P
+    {0x0051, 210, 5}, // Q
+    {0x0052, 215, 5}, // R
+    {0x0053, 220, 5}, // S
+    {0x0054, 225, 5}, // T
+    {0x0055, 230, 5}, // U
+    {0x0056, 235, 5}, // V
+    {0x0057, 240, 5}, // W
+    {0x0058, 245, 5}, // X
+    {0x0059, 250, 5}, // Y
+    {0x005A, 255, 5}, // Z
+    {0x005B, 260, 3}, // [
+    {0x005C, 263, 5}, // backslash
+    {0x005D, 268, 3}, // ]
+    {0x005E, 271, 5}, // ^
+    {0x005F, 276, 5}, // _
+    {0x0060, 281, 3}, // `
+    {0x0061, 284, 5}, // a
+    {0x0062, 289, 5}, // b
+    {0x0063, 294, 5}, // c
+    {0x0064, 299, 5}, // d
+    {0x0065, 304, 5}, // e
+    {0x0066, 309, 5}, // f
+    {0x0067, 314, 5}, // g
+    {0x0068, 319, 5}, // h
+    {0x0069, 324, 1}, // i
+    {0x006A, 325, 4}, // j
+    {0x006B, 329, 4}, // k
+    {0x006C, 333, 3}, // l
+    {0x006D, 336, 5}, // m
+    {0x006E, 341, 5}, // n
+    {0x006F, 346, 5}, // o
+    {0x0070, 351, 5}, // p
+    {0x0071, 356, 5}, // q
+    {0x0072, 361, 5}, // r
+    {0x0073, 366, 5}, // s
+    {0x0074, 371, 4}, // t
+    {0x0075, 375, 5}, // u
+    {0x0076, 380, 5}, // v
+    {0x0077, 385, 5}, // w
+    {0x0078, 390, 5}, // x
+    {0x0079, 395, 5}, // y
+    {0x007A, 400, 5}, // z
+    {0x007B, 405, 3}, // {
+    {0x007C, 408, 1}, // |
+    {0x007D, 409, 3}, // }
+    {0x007E, 412, 5}, // ~
+    {0x00A0, 417, 3}, // no-break space
+    {0x00A1, 420, 1}, // ¡
+    {0x00A2, 421, 5}, // ¢
+    {0x00A3, 426, 5}, // £
+    {0x00A4, 431, 5}, // ¤
+    {0x00A5, 436, 5}, // ¥
+    {0x00A6, 441, 1}, // ¦
+    {0x00A7, 442, 5}, // §
+    {0x00A8, 447, 3}, // ¨
+    {0x00A9, 450, 5}, // ©
+    {0x00AA, 455, 5}, // ª
+    {0x00AB, 460, 5}, // «
+    {0x00AC, 465, 5}, // ¬
+    {0x00AD, 470, 3}, // soft hyphen
+    {0x00AE, 473, 5}, // ®
+    {0x00AF, 478, 5}, // ¯
+    {0x00B0, 483, 4}, // °
+    {0x00B1, 487, 5}, // ±
+    {0x00B2, 492, 3}, // ²
+    {0x00B3, 495, 3}, // ³
+    {0x00B4, 498, 2}, // ´
+    {0x00B5, 500, 5}, // µ
+    {0x00B6, 505, 5}, // ¶
+    {0x00B7, 510, 1}, // ·
+    {0x00B8, 511, 2}, // ¸
+    {0x00B9, 513, 3}, // ¹
+    {0x00BA, 516, 5}, // º
+    {0x00BB, 521, 5}, // »
+    {0x00BC, 526, 5}, // ¼
+    {0x00BD, 531, 5}, // ½
+    {0x00BE, 536, 5}, // ¾
+    {0x00BF, 541, 5}, // ¿
+    {0x00C0, 546, 4}, // À
+    {0x00C1, 550, 4}, // Á
+    {0x00C2, 554, 4}, // Â
+    {0x00C3, 558, 4}, // Ã
+    {0x00C4, 562, 4}, // Ä
+    {0x00C5, 566, 4}, // Å
+    {0x00C6, 570, 5}, // Æ
+    {0x00C7, 575, 5}, // Ç
+    {0x00C8, 580, 4}, // È
+    {0x00C9, 584, 4}, // É
+    {0x00CA, 588, 4}, // Ê
+    {0x00CB, 592, 4}, // Ë
+    {0x00CC, 596, 3}, // Ì
+    {0x00CD, 599, 3}, // Í
+    {0x00CE, 602, 3}, // Î
+    {0x00CF, 605, 3}, // Ï
+    {0x00D0, 608, 5}, // Ð
+    {0x00D1, 613, 5}, // Ñ
+    {0x00D2, 618, 4}, // Ò
+    {0x00D3, 622, 4}, // Ó
+    {0x00D4, 626, 4}, // Ô
+    {0x00D5, 630, 4}, // Õ
+    {0x00D6, 634, 4}, // Ö
+    {0x00D7, 638, 5}, // ×
+    {0x00D8, 643, 5}, // Ø
+    {0x00D9, 648, 5}, // Ù
+    {0x00DA, 653, 5}, // Ú
+    {0x00DB, 658, 5}, // Û
+    {0x00DC, 663, 5}, // Ü
+    {0x00DD, 668, 5}, // Ý
+    {0x00DE, 673, 5}, // Þ
+    {0x00DF, 678, 5}, // ß
+    {0x00E0, 683, 5}, // à
+    {0x00E1, 688, 5}, // á
+    {0x00E2, 693, 5}, // â
+    {0x00E3, 698, 5}, // ã
+    {0x00E4, 703, 5}, // ä
+    {0x00E5, 708, 5}, // å
+    {0x00E6, 713, 5}, // æ
+    {0x00E7, 718, 5}, // ç
+    {0x00E8, 723, 5}, // è
+    {0x00E9, 728, 5}, // é
+    {0x00EA, 733, 5}, // ê
+    {0x00EB, 738, 5}, // ë
+    {0x00EC, 743, 2}, // ì
+    {0x00ED, 745, 2}, // í
+    {0x00EE, 747, 3}, // î
+    {0x00EF, 750, 3}, // ï
+    {0x00F0, 753, 5}, // ð
+    {0x00F1, 758, 5}, // ñ
+    {0x00F2, 763, 5}, // ò
+    {0x00F3, 768, 5}, // ó
+    {0x00F4, 773, 5}, // ô
+    {0x00F5, 778, 5}, // õ
+    {0x00F6, 783, 5}, // ö
+    {0x00F7, 788, 5}, // ÷
+    {0x00F8, 793, 5}, // ø
+    {0x00F9, 798, 5}, // ù
+    {0x00FA, 803, 5}, // ú
+    {0x00FB, 808, 5}, // û
+    {0x00FC, 813, 5}, // ü
+    {0x00FD, 818, 5}, // ý
+    {0x00FE, 823, 5}, // þ
+    {0x00FF, 828, 5}, // ÿ
+    {0x20AC, 833, 5}  // €
+};
+
+static const kerning_s fontBigKerning[] PROGMEM = {
+    {'\'', 's', -1},
+    {'F', ',', -1},
+    {'F', '.', -1},
+    {'L', '\'', -1},
+    {'L', 'T', -1},
+    {'L', 'V', -1},
+    {'L', 'Y', -1},
+    {'P', ',', -1},
+    {'P', '.', -1},
+    {'T', ',', -1},
+    {'T', '.', -1},
+    {'T', 'a', -1},
+    {'T', 'c', -1},
+    {'T', 'e', -1},
+    {'T', 'o', -1},
+    {'T', 'r', -1},
+    {'T', 'u', -1},
+    {'T', 'y', -1},
+    {'V', '.', -1},
+    {'Y', ',', -1},
+    {'Y', '.', -1},
+    {'Y', 'a', -1},
+    {'f', '.', -1},
+    {'r', '.', -1},
+    {'v', '.', -1}
+};
+
+// 5 rows: capitals and digits
+
+static const uint8_t fontSmallColumns[] PROGMEM = {
+    0x00, 0x00, // space
+    0x1f, 0x11, 0x11, 0x1f, // 0
+    0x12, 0x1f, 0x10, // 1
+    0x1d, 0x15, 0x15, 0x17, // 2
+    0x11, 0x15, 0x15, 0x1f, // 3
+    0x07, 0x04, 0x04, 0x1f, // 4
+    0x17, 0x15, 0x15, 0x1d, // 5
+    0x1f, 0x15, 0x15, 0x1d, // 6
+    0x01, 0x01, 0x1d, 0x03, // 7
+    0x1f, 0x15, 0x15, 0x1f, // 8
+    0x17, 0x15, 0x15, 0x1f, // 9
+    0x1e, 0x05, 0x05, 0x1e, // A
+    0x1f, 0x15, 0x15, 0x0a, // B
+    0x0e, 0x11, 0x11, 0x11, // C
+    0x1f, 0x11, 0x11, 0x0e, // D
+    0x1f, 0x15, 0x15, 0x11, // E
+    0x1f, 0x05, 0x05, 0x01, // F
+    0x0e, 0x11, 0x15, 0x0d, // G
+    0x1f, 0x04, 0x04, 0x1f, // H
+    0x11, 0x1f, 0x11, // I
+    0x09, 0x11, 0x11, 0x0f, // J
+    0x1f, 0x04, 0x0a, 0x11, // K
+    0x1f, 0x10, 0x10, 0x10, // L
+    0x1f, 0x02, 0x04, 0x02, 0x1f, // M
+    0x1f, 0x02, 0x04, 0x08, 0x1f, // N
+    0x1f, 0x11, 0x11, 0x1f, // O
+    0x1f, 0x05, 0x05, 0x02, // P
+    0x06, 0x09, 0x09, 0x16, // Q
+    0x1f, 0x05, 0x0d, 0x12, // R
+    0x12, 0x15, 0x15, 0x09, // S
+    0x01, 0x01, 0x1f, 0x01, 0x01, // T
+    0x0f, 0x10, 0x10, 0x10, 0x0f, // U
+    0x07, 0x08, 0x10, 0x08, 0x07, // V
+    0x1f, 0x08, 0x04, 0x08, 0x1f, // W
+    0x11, 0x0a, 0x04, 0x0a, 0x11, // X
+    0x01, 0x02, 0x1c, 0x02, 0x01, // Y
+    0x11, 0x19, 0x15, 0x13  // Z
+};
+
+static const glyph_s fontSmallGlyphs[] PROGMEM = {
+    {0x0020, 0, 2}, // space
+    {0x0030, 2, 4}, // 0
+    {0x0031, 6, 3}, // 1
+    {0x0032, 9, 4}, // 2
+    {0x0033, 13, 4}, // 3
+    {0x0034, 17, 4}, // 4
+    {0x0035, 21, 4}, // 5
+    {0x0036, 25, 4}, // 6
+    {0x0037, 29, 4}, // 7
+    {0x0038, 33, 4}, // 8
+    {0x0039, 37, 4}, // 9
+    {0x0041, 41, 4}, // A
+    {0x0042, 45, 4}, // B
+    {0x0043, 49, 4}, // C
+    {0x0044, 53, 4}, // D
+    {0x0045, 57, 4}, // E
+    {0x0046, 61, 4}, // F
+    {0x0047, 65, 4}, // G
+    {0x0048, 69, 4}, // H
+    {0x0049, 73, 3}, // I
+    {0x004A, 76, 4}, // J
+    {0x004B, 80, 4}, // K
+    {0x004C, 84, 4}, // L
+    {0x004D, 88, 5}, // M
+    {0x004E, 93, 5}, // N
+    {0x004F, 98, 4}, // O
+    {0x0050, 102, 4}, // P
+    {0x0051, 106, 4}, // Q
+    {0x0052, 110, 4}, // R
+    {0x0053, 114, 4}, // S
+    {0x0054, 118, 5}, // T
+    {0x0055, 123, 5}, // U
+    {0x0056, 128, 5}, // V
+    {0x0057, 133, 5}, // W
+    {0x0058, 138, 5}, // X
+    {0x0059, 143, 5}, // Y
+    {0x005A, 148, 4}  // Z
+};
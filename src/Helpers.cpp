@@ -54,6 +54,16 @@ String padStringZeros(String input)
     return (input.length() > 1) ? input : "0" + input;
 }
 
+// First maxBytes bytes of a UTF-8 text, without cutting a character in two.
+String substringUtf8(String input, uint16_t maxBytes)
+{
+    if (input.length() <= maxBytes)
+        return input;
+    while (maxBytes && ((input[maxBytes] & 0xC0) == 0x80))
+        maxBytes--;
+    return input.substring(0, maxBytes);
+}
+
 // Set ESP time from Webpage
 void handleTimeSetting(String input) // 2026-05-01T17:58
 {
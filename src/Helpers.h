@@ -10,5 +10,6 @@ uint8_t getHour(time_t zeit);
 uint8_t getMinute(time_t zeit);
 int getMoonphase(int y, int m, int d);
 String padStringZeros(String input);
+String substringUtf8(String input, uint16_t maxBytes);
 void handleTimeSetting(String input);
 String formatUptime(time_t total_seconds);
\ No newline at end of file
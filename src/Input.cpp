@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Input.cpp
+//*****************************************************************************
+
+#include "Input.h"
+
+Input::Input()
+{
+    head = 0;
+    tail = 0;
+    dropped = 0;
+    droppedSeen = 0;
+    memset((void *)lastLevel, 0, sizeof(lastLevel));
+    memset(buttons, 0, sizeof(buttons));
+    handler = nullptr;
+}
+
+void Input::setHandler(void (*handler)(eInputSource source, eInputGesture gesture))
+{
+    this->handler = handler;
+}
+
+// Queue an edge. Called from the interrupts, so it does nothing else.
+ICACHE_RAM_ATTR void Input::push(eInputSource source, boolean pressed)
+{
+    lastLevel[source] = pressed;
+    uint8_t h = head.load(std::memory_order_relaxed);
+    uint8_t next = (h + 1) & (INPUT_QUEUE_SIZE - 1);
+    if (next == tail.load(std::memory_order_acquire))
+    {
+        dropped++;
+        return;
+    }
+    events[h].time = millis();
+    events[h].source = source;
+    events[h].pressed = pressed;
+    head.store(next, std::memory_order_release);
+}
+
+// Queue a press and release from the loop, e.g. for an IR command.
+void Input::click(eInputSource source)
+{
+    noInterrupts();
+    push(source, true);
+    push(source, false);
+    interrupts();
+}
+
+// Take the queued edges and call the handler with the gestures. Called by the loop.
+void Input::handle()
+{
+    uint8_t h = head.load(std::memory_order_acquire);
+    uint8_t t = tail.load(std::memory_order_relaxed);
+    while (t != h)
+    {
+        event_s event = events[t];
+        t = (t + 1) & (INPUT_QUEUE_SIZE - 1);
+        tail.store(t, std::memory_order_release);
+        buttons[event.source].level = event.pressed;
+        update(event.source, event.time);
+    }
+
+    // The queue lost edges, so the level pushed last may not be in it.
+    uint32_t d = dropped;
+    if (d != droppedSeen)
+    {
+        droppedSeen = d;
+        for (uint8_t source = 0; source < INPUT_SOURCES; source++)
+            buttons[source].level = lastLevel[source];
+    }
+
+    // Edges held back by the debounce time and long presses
+    uint32_t now = millis();
+    for (uint8_t source = 0; source < INPUT_SOURCES; source++)
+        update((eInputSource)source, now);
+}
+
+// Edges lost because the queue was full.
+uint32_t Input::getDropped()
+{
+    return dropped;
+}
+
+// A change is taken right away, then edges are ignored for INPUT_DEBOUNCE_MS.
+// The level seen last counts after that.
+void Input::update(eInputSource source, uint32_t time)
+{
+    button_s &button = buttons[source];
+    if ((button.level != button.pressed) && ((int32_t)(time - button.changed) >= INPUT_DEBOUNCE_MS))
+    {
+        button.pressed = button.level;
+        button.changed = time;
+        if (button.pressed)
+        {
+            boolean isDouble = button.doubleArmed && (time - button.lastPress < INPUT_DOUBLE_PRESS_MS);
+            button.doubleArmed = !isDouble;
+            button.lastPress = time;
+            button.longSent = false;
+            if (handler)
+            {
+                handler(source, INPUT_PRESS);
+                if (isDouble)
+                    handler(source, INPUT_DOUBLE_PRESS);
+            }
+        }
+    }
+    if (button.pressed && !button.longSent && ((int32_t)(time - button.changed) >= INPUT_LONG_PRESS_MS))
+    {
+        button.longSent = true;
+        button.doubleArmed = false;
+        if (handler)
+            handler(source, INPUT_LONG_PRESS);
+    }
+}
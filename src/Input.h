@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "Configuration.h"
+
+#define INPUT_QUEUE_SIZE 16 // Power of 2
+
+// Buttons and the IR commands for them.
+enum eInputSource : uint8_t {
+    INPUT_ONOFF,
+    INPUT_TIME,
+    INPUT_MODE,
+    INPUT_SOURCES
+};
+
+enum eInputGesture : uint8_t {
+    INPUT_PRESS,        // Right when the button goes down
+    INPUT_LONG_PRESS,   // Held for INPUT_LONG_PRESS_MS
+    INPUT_DOUBLE_PRESS  // Second press within INPUT_DOUBLE_PRESS_MS, after its INPUT_PRESS
+};
+
+// Input events. Interrupts only push the time and level of an edge into a
+// lock-free single producer, single consumer ring. handle() in the loop takes
+// them out, debounces them and calls the handler with the gestures.
+class Input
+{
+public:
+    Input();
+
+    void setHandler(void (*handler)(eInputSource source, eInputGesture gesture));
+    void push(eInputSource source, boolean pressed);
+    void click(eInputSource source);
+    void handle();
+    uint32_t getDropped();
+
+private:
+    struct event_s
+    {
+        uint32_t time; // millis()
+        eInputSource source;
+        boolean pressed;
+    } events[INPUT_QUEUE_SIZE];
+    std::atomic<uint8_t> head; // Written by the producer only
+    std::atomic<uint8_t> tail; // Written by the consumer only
+    volatile uint32_t dropped;
+    uint32_t droppedSeen; // By handle()
+    volatile boolean lastLevel[INPUT_SOURCES]; // Last edge pushed, even if dropped
+
+    struct button_s
+    {
+        boolean pressed; // Debounced
+        boolean level; // Last edge seen
+        uint32_t changed; // millis() of the last debounced change
+        uint32_t lastPress; // millis()
+        boolean longSent;
+        boolean doubleArmed; // The next press may be a double press
+    } buttons[INPUT_SOURCES];
+
+    void (*handler)(eInputSource source, eInputGesture gesture);
+
+    void update(eInputSource source, uint32_t time);
+};
@@ -3,25 +3,277 @@
 //*****************************************************************************
 
 #include "LedDriver.h"
+#include "LedLayout.h"
+#include "Profiler.h"
+
+// Brightness (0 to 255) to LED output level (0 to 4096, 12 bit fraction).
+struct BrightnessTable
+{
+    uint16_t level[256];
+};
+
+constexpr BrightnessTable brightnessTable()
+{
+    BrightnessTable table = {};
+    for (uint16_t i = 0; i <= 255; i++)
+    {
+        double luminance = i / 255.0;
+#ifdef BRIGHTNESS_GAMMA
+        // CIE 1931 lightness to luminance between MIN_BRIGHTNESS and 255. Up to
+        // MIN_BRIGHTNESS it stays linear, so the night is as bright as without.
+        if (i > MIN_BRIGHTNESS)
+        {
+            double minLuminance = MIN_BRIGHTNESS / 255.0;
+            double lightness = (i - MIN_BRIGHTNESS) * 100.0 / (255 - MIN_BRIGHTNESS);
+            double t = (lightness + 16.0) / 116.0;
+            double curve = (lightness <= 8.0) ? lightness / 903.3 : t * t * t;
+            luminance = minLuminance + (1.0 - minLuminance) * curve;
+        }
+#endif
+        table.level[i] = luminance * 4096.0 + 0.5;
+    }
+    return table;
+}
+
+constexpr boolean brightnessRises(const BrightnessTable &table)
+{
+    for (uint16_t i = 1; i <= 255; i++)
+        if (table.level[i] < table.level[i - 1])
+            return false;
+    return true;
+}
+
+static constexpr BrightnessTable brightnessLevels PROGMEM = brightnessTable();
+static_assert(brightnessRises(brightnessLevels), "The LED output has to rise with the brightness.");
+static_assert(brightnessLevels.level[MIN_BRIGHTNESS] == (uint16_t)(MIN_BRIGHTNESS * 4096.0 / 255.0 + 0.5),
+              "MIN_BRIGHTNESS has to give the same output with and without BRIGHTNESS_GAMMA.");
+
+// The palette as sent to the LEDs. RGBW strips get the white part of each
+// color on the white channel, measured against the color of their white LEDs.
+struct LedPalette
+{
+    ledColor_s color[COLOR_COUNT + 1];
+};
+
+constexpr LedPalette ledPalette()
+{
+    LedPalette palette = {};
+#ifdef NEOPIXEL_RGBW
+    const uint8_t whitePoint[3] = {RGBW_WHITE_POINT};
+#endif
+    for (uint8_t i = 0; i <= COLOR_COUNT; i++)
+    {
+        uint8_t red = defaultColors[i].red;
+        uint8_t green = defaultColors[i].green;
+        uint8_t blue = defaultColors[i].blue;
+        uint8_t white = 0;
+#ifdef NEOPIXEL_RGBW
+        // As much white as fits into all three channels.
+        uint16_t maxWhite = 255;
+        if (whitePoint[0] && (red * 255 / whitePoint[0] < maxWhite))
+            maxWhite = red * 255 / whitePoint[0];
+        if (whitePoint[1] && (green * 255 / whitePoint[1] < maxWhite))
+            maxWhite = green * 255 / whitePoint[1];
+        if (whitePoint[2] && (blue * 255 / whitePoint[2] < maxWhite))
+            maxWhite = blue * 255 / whitePoint[2];
+        white = maxWhite;
+        red -= white * whitePoint[0] / 255;
+        green -= white * whitePoint[1] / 255;
+        blue -= white * whitePoint[2] / 255;
+#endif
+        palette.color[i] = {red, green, blue, white};
+    }
+    return palette;
+}
+
+static constexpr LedPalette ledColors = ledPalette();
+
+#if defined(POWER_LIMIT_MA) && (POWER_LIMIT_MA <= NUMPIXELS * LED_IDLE_MA)
+#error POWER_LIMIT_MA is below the idle current of the LEDs.
+#endif
+
+#if defined(LED_DRIVER_DMA) && (PIN_LEDS_DATA != NEOPIXELBUS_PIN)
+#error NEOPIXELBUS_METHOD only sends on NEOPIXELBUS_PIN. Set PIN_LEDS_DATA to it.
+#endif
+
+#if defined(ONOFF_BUTTON) && (PIN_ONOFF_BUTTON == PIN_LEDS_DATA)
+#error ONOFF_BUTTON is on the data pin of the LEDs.
+#endif
+
+#if defined(ESP_LED) && (PIN_LED == PIN_LEDS_DATA)
+#error ESP_LED is on the data pin of the LEDs.
+#endif
+
+#ifdef TEMPORAL_DITHERING
+// Bit reversed order spreads the dither steps evenly over 16 frames.
+static const uint8_t ditherSequence[16] = {0, 8, 4, 12, 2, 10, 6, 14, 1, 9, 5, 13, 3, 11, 7, 15};
+#endif
 
 LedDriver::LedDriver()
 {
+#ifdef LED_DRIVER_DMA
+    strip = new NeoPixelBus<NEOPIXELBUS_FEATURE, NEOPIXELBUS_METHOD>(NUMPIXELS, PIN_LEDS_DATA);
+    framePending = false;
+#else
     strip = new Adafruit_NeoPixel(NUMPIXELS, PIN_LEDS_DATA, NEOPIXEL_TYPE);
-    strip->begin();
+#endif
+    memset(shownPixels, 0, sizeof(shownPixels));
+    forceShow = true; // The LEDs keep their state over a reset of the ESP.
+    shownFrames = 0;
+    skippedFrames = 0;
+    scaledColorIndex = 0xFF;
+    scaledBrightness = 0;
+    frameLoad = 0;
+    frameCurrent = NUMPIXELS * LED_IDLE_MA;
+    powerLimit = 256;
+#ifdef TEMPORAL_DITHERING
+    ditherFrame = 0;
+    ditherPhase = 0;
+#endif
 }
 
 LedDriver::~LedDriver()
 {
 }
 
+// Start sending to the LEDs. Call this after Serial.begin(): with I2S DMA the
+// data pin is RX, which Serial.begin() would take back.
+void LedDriver::begin()
+{
+#ifdef LED_DRIVER_DMA
+    strip->Begin();
+#else
+    strip->begin();
+#endif
+}
+
 void LedDriver::clear()
 {
+    frameLoad = 0;
+#ifdef LED_DRIVER_DMA
+    strip->ClearTo(0);
+#else
     strip->clear();
+#endif
 }
 
 void LedDriver::show()
 {
+#ifdef TEMPORAL_DITHERING
+    ditherFrame++;
+    ditherPhase = ditherSequence[ditherFrame % 16];
+#endif
+#ifdef POWER_LIMIT_MA
+    limitPower();
+#endif
+    frameCurrent = frameLoad * LED_CHANNEL_MA / 255 + NUMPIXELS * LED_IDLE_MA;
+    frameLoad = 0;
+
+    // show() blocks interrupts for about 30 us per LED. Only send frames that changed.
+    if (!forceShow && !memcmp(getPixels(), shownPixels, sizeof(shownPixels)))
+    {
+#ifdef LED_DRIVER_DMA
+        framePending = false;
+#endif
+        skippedFrames++;
+        return;
+    }
+#ifdef LED_DRIVER_DMA
+    if (!strip->CanShow())
+    {
+        // The last frame is still on its way. handle() sends this one later.
+        framePending = true;
+        return;
+    }
+#endif
+    sendFrame();
+}
+
+// Send a pending frame once the DMA is done with the last one. Call this from loop().
+void LedDriver::handle()
+{
+#ifdef LED_DRIVER_DMA
+    if (framePending && strip->CanShow())
+        sendFrame();
+#endif
+}
+
+// True while a frame is being sent to the LEDs in the background.
+boolean LedDriver::isFrameInFlight()
+{
+#ifdef LED_DRIVER_DMA
+    return framePending || !strip->CanShow();
+#else
+    return false;
+#endif
+}
+
+// Estimated current of the last frame in mA.
+uint16_t LedDriver::getCurrent()
+{
+    return frameCurrent;
+}
+
+#ifdef POWER_LIMIT_MA
+// Adjust the limit for the next frames to the load of this one.
+// setPixel() applies the limit while the frame is drawn. Only the first frame
+// over the limit has to be scaled down here.
+void LedDriver::limitPower()
+{
+    const uint32_t budget = (uint32_t)(POWER_LIMIT_MA - NUMPIXELS * LED_IDLE_MA) * 255 / LED_CHANNEL_MA;
+    uint32_t fullLoad = frameLoad * 256 / powerLimit;
+    uint16_t limit = (fullLoad > budget) ? budget * 256 / fullLoad : 256;
+    if (limit != powerLimit)
+    {
+        powerLimit = limit ? limit : 1;
+        scaledColorIndex = 0xFF;
+    }
+    if (frameLoad > budget)
+    {
+        uint16_t factor = budget * 256 / frameLoad;
+        uint8_t *pixels = getPixels();
+        for (uint16_t i = 0; i < sizeof(shownPixels); i++)
+            pixels[i] = (pixels[i] * factor) >> 8;
+#ifdef LED_DRIVER_DMA
+        strip->Dirty();
+#endif
+        frameLoad = budget;
+    }
+}
+#endif
+
+uint8_t *LedDriver::getPixels()
+{
+#ifdef LED_DRIVER_DMA
+    return strip->Pixels();
+#else
+    return strip->getPixels();
+#endif
+}
+
+void LedDriver::sendFrame()
+{
+    memcpy(shownPixels, getPixels(), sizeof(shownPixels));
+    forceShow = false;
+    PROFILER_START(PROFILE_SHOW);
+#ifdef LED_DRIVER_DMA
+    framePending = false;
+    strip->Show();
+#else
     strip->show();
+#endif
+    PROFILER_STOP(PROFILE_SHOW);
+    shownFrames++;
+}
+
+uint32_t LedDriver::getShownFrames()
+{
+    return shownFrames;
+}
+
+uint32_t LedDriver::getSkippedFrames()
+{
+    return skippedFrames;
 }
 
 void LedDriver::setPixel(uint8_t x, uint8_t y, uint8_t color, uint8_t brightness)
@@ -31,84 +283,106 @@ void LedDriver::setPixel(uint8_t x, uint8_t y, uint8_t color, uint8_t brightness
 
 void LedDriver::setPixel(uint8_t num, uint8_t color, uint8_t brightness)
 {
-#ifdef LED_LAYOUT_HORIZONTAL_1
-    const uint8_t ledMap[] = {
-        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
-        21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
-        22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
-        43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33,
-        44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
-        65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55,
-        66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
-        87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77,
-        88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98,
-        109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99,
-        111, 112, 113, 110, 114};
-#endif
-
-#ifdef LED_LAYOUT_VERTICAL_1
-    const uint8_t ledMap[] = {
-        1, 21, 22, 41, 42, 61, 62, 81, 82, 101, 103,
-        2, 20, 23, 40, 43, 60, 63, 80, 83, 100, 104,
-        3, 19, 24, 39, 44, 59, 64, 79, 84, 99, 105,
-        4, 18, 25, 38, 45, 58, 65, 78, 85, 98, 106,
-        5, 17, 26, 37, 46, 57, 66, 77, 86, 97, 107,
-        6, 16, 27, 36, 47, 56, 67, 76, 87, 96, 108,
-        7, 15, 28, 35, 48, 55, 68, 75, 88, 95, 109,
-        8, 14, 29, 34, 49, 54, 69, 74, 89, 94, 110,
-        9, 13, 30, 33, 50, 53, 70, 73, 90, 93, 111,
-        10, 12, 31, 32, 51, 52, 71, 72, 91, 92, 112,
-        0, 102, 113, 11, 114};
-#endif
-
-#ifdef LED_LAYOUT_VERTICAL_2
-    const uint8_t ledMap[] = {
-        9, 10, 29, 30, 49, 50, 69, 70, 89, 90, 109,
-        8, 11, 28, 31, 48, 51, 68, 71, 88, 91, 108,
-        7, 12, 27, 32, 47, 52, 67, 72, 87, 92, 107,
-        6, 13, 26, 33, 46, 53, 66, 73, 86, 93, 106,
-        5, 14, 25, 34, 45, 54, 65, 74, 85, 94, 105,
-        4, 15, 24, 35, 44, 55, 64, 75, 84, 95, 104,
-        3, 16, 23, 36, 43, 56, 63, 76, 83, 96, 103,
-        2, 17, 22, 37, 42, 57, 62, 77, 82, 97, 102,
-        1, 18, 21, 38, 41, 58, 61, 78, 81, 98, 101,
-        0, 19, 20, 39, 40, 59, 60, 79, 80, 99, 100,
-        112, 110, 114, 113, 111};
-#endif
-
-#ifdef LED_LAYOUT_VERTICAL_3
-    const uint8_t ledMap[] = {
-        9, 10, 29, 30, 49, 50, 69, 70, 89, 90, 109,
-        8, 11, 28, 31, 48, 51, 68, 71, 88, 91, 108,
-        7, 12, 27, 32, 47, 52, 67, 72, 87, 92, 107,
-        6, 13, 26, 33, 46, 53, 66, 73, 86, 93, 106,
-        5, 14, 25, 34, 45, 54, 65, 74, 85, 94, 105,
-        4, 15, 24, 35, 44, 55, 64, 75, 84, 95, 104,
-        3, 16, 23, 36, 43, 56, 63, 76, 83, 96, 103,
-        2, 17, 22, 37, 42, 57, 62, 77, 82, 97, 102,
-        1, 18, 21, 38, 41, 58, 61, 78, 81, 98, 101,
-        0, 19, 20, 39, 40, 59, 60, 79, 80, 99, 100,
-        111, 110, 113, 112, 114};
-#endif
-
-    uint8_t red = brightness * 0.0039 * defaultColors[color].red;
-    uint8_t green = brightness * 0.0039 * defaultColors[color].green;
-    uint8_t blue = brightness * 0.0039 * defaultColors[color].blue;
+    if ((color != scaledColorIndex) || (brightness != scaledBrightness))
+        scaleColor(color, brightness);
+#ifdef TEMPORAL_DITHERING
+    uint8_t red = scaledColor.red + (scaledFraction.red > ditherPhase);
+    uint8_t green = scaledColor.green + (scaledFraction.green > ditherPhase);
+    uint8_t blue = scaledColor.blue + (scaledFraction.blue > ditherPhase);
+#ifdef NEOPIXEL_RGBW
+    uint8_t white = scaledColor.white + (scaledFraction.white > ditherPhase);
+#endif
+#else
+    uint8_t red = scaledColor.red;
+    uint8_t green = scaledColor.green;
+    uint8_t blue = scaledColor.blue;
+#ifdef NEOPIXEL_RGBW
+    uint8_t white = scaledColor.white;
+#endif
+#endif
+
+    frameLoad += scaledLoad;
 
 #ifdef NEOPIXEL_RGBW
-    uint8_t white = 0xFF;
-    if (red < white)
-        white = red;
-    if (green < white)
-        white = green;
-    if (blue < white)
-        white = blue;
-    strip->setPixelColor(ledMap[num], red - white, green - white, blue - white, white);
+    writePixel(num, red, green, blue, white);
+#else
+    writePixel(num, red, green, blue, 0);
+#endif
+}
+
+// Mix two colors of the palette. mix is the share of colorTo (0 to 255).
+// Mixed before the brightness is applied, so the pixel does not dim halfway.
+void LedDriver::setPixelMix(uint8_t num, uint8_t color, uint8_t colorTo, uint8_t mix, uint8_t brightness)
+{
+    uint16_t level = pgm_read_word(&brightnessLevels.level[brightness]);
+#ifdef POWER_LIMIT_MA
+    level = ((uint32_t)level * powerLimit) >> 8;
+#endif
+    const ledColor_s &from = ledColors.color[color];
+    const ledColor_s &to = ledColors.color[colorTo];
+    uint8_t red = scale((from.red * (255 - mix) + to.red * mix) / 255, level);
+    uint8_t green = scale((from.green * (255 - mix) + to.green * mix) / 255, level);
+    uint8_t blue = scale((from.blue * (255 - mix) + to.blue * mix) / 255, level);
+    uint8_t white = scale((from.white * (255 - mix) + to.white * mix) / 255, level);
+    frameLoad += red + green + blue + white;
+    writePixel(num, red, green, blue, white);
+}
+
+void LedDriver::writePixel(uint8_t num, uint8_t red, uint8_t green, uint8_t blue, uint8_t white)
+{
+#ifdef NEOPIXEL_RGBW
+#ifdef LED_DRIVER_DMA
+    strip->SetPixelColor(ledLayout.map[num], RgbwColor(red, green, blue, white));
+#else
+    strip->setPixelColor(ledLayout.map[num], red, green, blue, white);
+#endif
 #endif
 
 #ifdef NEOPIXEL_RGB
-    strip->setPixelColor(ledMap[num], red, green, blue);
+    (void)white;
+#ifdef LED_DRIVER_DMA
+    strip->SetPixelColor(ledLayout.map[num], RgbColor(red, green, blue));
+#else
+    strip->setPixelColor(ledLayout.map[num], red, green, blue);
 #endif
+#endif
+}
+
+// Scale a color from the palette by the brightness level. Integer only, the ESP8266 has no FPU.
+void LedDriver::scaleColor(uint8_t color, uint8_t brightness)
+{
+    uint16_t level = pgm_read_word(&brightnessLevels.level[brightness]);
+#ifdef POWER_LIMIT_MA
+    level = ((uint32_t)level * powerLimit) >> 8;
+#endif
+    scaledColorIndex = color;
+    scaledBrightness = brightness;
+    const ledColor_s &paletteColor = ledColors.color[color];
+    scaledColor.red = scale(paletteColor.red, level);
+    scaledColor.green = scale(paletteColor.green, level);
+    scaledColor.blue = scale(paletteColor.blue, level);
+    scaledColor.white = scale(paletteColor.white, level);
+    scaledLoad = scaledColor.red + scaledColor.green + scaledColor.blue + scaledColor.white;
+#ifdef TEMPORAL_DITHERING
+    scaledFraction.red = fraction(paletteColor.red, level);
+    scaledFraction.green = fraction(paletteColor.green, level);
+    scaledFraction.blue = fraction(paletteColor.blue, level);
+    scaledFraction.white = fraction(paletteColor.white, level);
+#endif
+}
+
+// value * level / 4096. Rounded unless the remainder is dithered.
+uint8_t LedDriver::scale(uint8_t value, uint16_t level)
+{
+#ifdef TEMPORAL_DITHERING
+    return ((uint32_t)value * level) >> 12;
+#else
+    return ((uint32_t)value * level + 0x800) >> 12;
+#endif
+}
 
-    return;
+// The 4 bits below the output value.
+uint8_t LedDriver::fraction(uint8_t value, uint16_t level)
+{
+    return (((uint32_t)value * level) >> 8) & 0x0F;
 }
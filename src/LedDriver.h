@@ -1,20 +1,81 @@
 #pragma once
 
-#include <Adafruit_NeoPixel.h>
 #include "Configuration.h"
+#ifdef LED_DRIVER_DMA
+#include <NeoPixelBus.h>
+#else
+#include <Adafruit_NeoPixel.h>
+#endif
 #include "Colors.h"
 
+#ifdef NEOPIXEL_RGBW
+#define LED_BYTES_PER_PIXEL 4
+#else
+#define LED_BYTES_PER_PIXEL 3
+#endif
+
+struct ledColor_s
+{
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    uint8_t white;
+};
+
 class LedDriver {
 public:
     LedDriver();
     ~LedDriver();
 
+    void begin();
     void clear();
     void show();
+    void handle();
+    boolean isFrameInFlight();
     void setPixel(uint8_t x, uint8_t y, uint8_t color, uint8_t brightness);
     void setPixel(uint8_t num, uint8_t color, uint8_t brightness);
+    void setPixelMix(uint8_t num, uint8_t color, uint8_t colorTo, uint8_t mix, uint8_t brightness);
+    uint32_t getShownFrames();
+    uint32_t getSkippedFrames();
+    uint16_t getCurrent();
 
 private:
+#ifdef LED_DRIVER_DMA
+    NeoPixelBus<NEOPIXELBUS_FEATURE, NEOPIXELBUS_METHOD>* strip;
+    boolean framePending;
+#else
     Adafruit_NeoPixel* strip;
+#endif
+
+    // Copy of the frame on the LEDs. show() is skipped if nothing changed.
+    uint8_t shownPixels[NUMPIXELS * LED_BYTES_PER_PIXEL];
+    boolean forceShow;
+    uint32_t shownFrames;
+    uint32_t skippedFrames;
+
+    // Sum of all channels set in this frame. Used to estimate the current.
+    uint32_t frameLoad;
+    uint16_t frameCurrent;
+    uint16_t powerLimit; // 256 is no limit
+
+    // Last color scaled by setPixel(). Most pixels of a frame share color and brightness.
+    uint8_t scaledColorIndex;
+    uint8_t scaledBrightness;
+    ledColor_s scaledColor;
+    uint16_t scaledLoad;
+#ifdef TEMPORAL_DITHERING
+    ledColor_s scaledFraction;
+    uint8_t ditherFrame;
+    uint8_t ditherPhase;
+#endif
 
-};
\ No newline at end of file
+    uint8_t *getPixels();
+    void sendFrame();
+#ifdef POWER_LIMIT_MA
+    void limitPower();
+#endif
+    void scaleColor(uint8_t color, uint8_t brightness);
+    void writePixel(uint8_t num, uint8_t red, uint8_t green, uint8_t blue, uint8_t white);
+    static uint8_t scale(uint8_t value, uint16_t level);
+    static uint8_t fraction(uint8_t value, uint16_t level);
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+#include "Configuration.h"
+
+// Maps the number of a pixel (x + y * 11, corner LEDs 110 to 113 and the
+// alarm LED 114) to the position of the LED on the strip.
+struct LedLayout
+{
+    uint8_t map[NUMPIXELS];
+};
+
+// Build the layout of a strip which runs through the matrix as a serpentine.
+// Horizontal strips run row by row, vertical strips column by column.
+// If firstLineReversed is set the first row runs right to left (or the first
+// column bottom up). The corner LEDs are given clockwise starting top left.
+constexpr LedLayout serpentineLayout(bool vertical, bool firstLineReversed,
+                                     uint8_t topLeft, uint8_t topRight, uint8_t bottomRight, uint8_t bottomLeft, uint8_t alarm)
+{
+    LedLayout layout = {};
+    for (uint8_t y = 0; y <= 9; y++)
+    {
+        for (uint8_t x = 0; x <= 10; x++)
+        {
+            uint8_t line = vertical ? x : y;
+            uint8_t length = vertical ? 10 : 11;
+            uint8_t pos = vertical ? y : x;
+            if (((line % 2) == 1) != firstLineReversed)
+                pos = length - 1 - pos;
+            layout.map[x + y * 11] = line * length + pos;
+        }
+    }
+    layout.map[110] = topLeft;
+    layout.map[111] = topRight;
+    layout.map[112] = bottomRight;
+    layout.map[113] = bottomLeft;
+    layout.map[114] = alarm;
+    return layout;
+}
+
+#if defined(LED_LAYOUT_HORIZONTAL_1)
+constexpr LedLayout ledLayout = serpentineLayout(false, false, 111, 112, 113, 110, 114);
+#endif
+
+#if defined(LED_LAYOUT_VERTICAL_1)
+// The corner LEDs are part of the strip. No rule for this one.
+constexpr LedLayout ledLayout = {{
+    1, 21, 22, 41, 42, 61, 62, 81, 82, 101, 103,
+    2, 20, 23, 40, 43, 60, 63, 80, 83, 100, 104,
+    3, 19, 24, 39, 44, 59, 64, 79, 84, 99, 105,
+    4, 18, 25, 38, 45, 58, 65, 78, 85, 98, 106,
+    5, 17, 26, 37, 46, 57, 66, 77, 86, 97, 107,
+    6, 16, 27, 36, 47, 56, 67, 76, 87, 96, 108,
+    7, 15, 28, 35, 48, 55, 68, 75, 88, 95, 109,
+    8, 14, 29, 34, 49, 54, 69, 74, 89, 94, 110,
+    9, 13, 30, 33, 50, 53, 70, 73, 90, 93, 111,
+    10, 12, 31, 32, 51, 52, 71, 72, 91, 92, 112,
+    0, 102, 113, 11, 114}};
+#endif
+
+#if defined(LED_LAYOUT_VERTICAL_2)
+constexpr LedLayout ledLayout = serpentineLayout(true, true, 112, 110, 114, 113, 111);
+#endif
+
+#if defined(LED_LAYOUT_VERTICAL_3)
+constexpr LedLayout ledLayout = serpentineLayout(true, true, 111, 110, 113, 112, 114);
+#endif
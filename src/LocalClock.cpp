@@ -0,0 +1,260 @@
+//*****************************************************************************
+// LocalClock.cpp
+//*****************************************************************************
+
+#include "LocalClock.h"
+#include "Debug.h"
+
+static const char *parseNumber(const char *s, int32_t &value)
+{
+    if (!isdigit(*s))
+        return nullptr;
+    value = 0;
+    while (isdigit(*s))
+        value = value * 10 + (*s++ - '0');
+    return s;
+}
+
+LocalClock::LocalClock()
+{
+    hasRules = false;
+    hasDst = false;
+    stdOffset = 0;
+    dstOffset = 0;
+    tableYear = 0;
+    dstStartTime = 0;
+    dstEndTime = 0;
+    nextChange = 0;
+    valid = false;
+    lastTime = 0;
+    memset(&tmNow, 0, sizeof(tmNow));
+    recalculations = 0;
+}
+
+// Use the rules of a POSIX TZ string like "CET-1CEST,M3.5.0,M10.5.0/3".
+boolean LocalClock::begin(const char *timezone)
+{
+    hasRules = false;
+    valid = false;
+    tableYear = 0;
+
+    const char *s = parseName(timezone);
+    if (s)
+        s = parseOffset(s, stdOffset);
+    if (!s)
+        return false;
+    stdOffset = -stdOffset; // POSIX counts west of UTC
+    hasDst = (*s != '\0');
+    if (hasDst)
+    {
+        s = parseName(s);
+        if (!s)
+            return false;
+        dstOffset = stdOffset + 3600;
+        if (*s && (*s != ','))
+        {
+            s = parseOffset(s, dstOffset);
+            if (!s)
+                return false;
+            dstOffset = -dstOffset;
+        }
+        if ((*s++ != ',') || !(s = parseRule(s, dstStart)) || (*s++ != ',') || !(s = parseRule(s, dstEnd)))
+        {
+            DEBUG_SERIAL_PRINTLN(F("[ERROR] Unsupported DST rule, using localtime()"));
+            return false;
+        }
+    }
+    if (*s)
+        return false;
+    hasRules = true;
+    return true;
+}
+
+// Update the local time from the system time. Returns true if the second changed.
+boolean LocalClock::update()
+{
+    return update(time(nullptr));
+}
+
+boolean LocalClock::update(time_t now)
+{
+    if (valid && (now == lastTime))
+        return false;
+    if (!hasRules)
+        localtime_r(&now, &tmNow);
+    else if (valid && (now == lastTime + 1) && (now < nextChange))
+        advance();
+    else
+        calculate(now);
+    valid = true;
+    lastTime = now;
+    return true;
+}
+
+// The local time at the last update().
+const struct tm &LocalClock::getTime()
+{
+    return tmNow;
+}
+
+// Number of times the local time was computed in full.
+uint32_t LocalClock::getRecalculations()
+{
+    return recalculations;
+}
+
+void LocalClock::calculate(time_t now)
+{
+    recalculations++;
+    time_t local = now + stdOffset;
+    struct tm tmStd;
+    gmtime_r(&local, &tmStd);
+    int16_t year = tmStd.tm_year + 1900;
+    if (year != tableYear)
+        calculateTable(year);
+
+    // The DST period wraps around the new year on the southern hemisphere.
+    boolean dst = false;
+    if (hasDst)
+    {
+        if (dstStartTime < dstEndTime)
+            dst = (now >= dstStartTime) && (now < dstEndTime);
+        else
+            dst = (now >= dstStartTime) || (now < dstEndTime);
+    }
+    local = now + (dst ? dstOffset : stdOffset);
+    gmtime_r(&local, &tmNow);
+    tmNow.tm_isdst = dst;
+
+    nextChange = (time_t)daysFromCivil(year + 1, 1, 1) * 86400 - stdOffset;
+    if (hasDst && (dstStartTime > now) && (dstStartTime < nextChange))
+        nextChange = dstStartTime;
+    if (hasDst && (dstEndTime > now) && (dstEndTime < nextChange))
+        nextChange = dstEndTime;
+}
+
+// Add one second.
+void LocalClock::advance()
+{
+    if (++tmNow.tm_sec < 60)
+        return;
+    tmNow.tm_sec = 0;
+    if (++tmNow.tm_min < 60)
+        return;
+    tmNow.tm_min = 0;
+    if (++tmNow.tm_hour < 24)
+        return;
+    tmNow.tm_hour = 0;
+    tmNow.tm_wday = (tmNow.tm_wday + 1) % 7;
+    tmNow.tm_yday++;
+    if (++tmNow.tm_mday <= daysInMonth(tmNow.tm_year + 1900, tmNow.tm_mon + 1))
+        return;
+    tmNow.tm_mday = 1;
+    if (++tmNow.tm_mon < 12)
+        return;
+    tmNow.tm_mon = 0;
+    tmNow.tm_yday = 0;
+    tmNow.tm_year++;
+}
+
+// DST changes of the year in UTC.
+void LocalClock::calculateTable(int16_t year)
+{
+    tableYear = year;
+    if (!hasDst)
+        return;
+    dstStartTime = getRuleTime(year, dstStart, stdOffset);
+    dstEndTime = getRuleTime(year, dstEnd, dstOffset);
+    DEBUG_SERIAL_PRINTLN(F("DST ") + String(year) + F(": ") + String((uint32_t)dstStartTime) + F(" to ") + String((uint32_t)dstEndTime));
+}
+
+// The rule's time is local time with the offset in effect before the change.
+time_t LocalClock::getRuleTime(int16_t year, const rule_s &rule, int32_t offset)
+{
+    int32_t first = daysFromCivil(year, rule.month, 1);
+    uint8_t firstWeekday = (first % 7 + 11) % 7; // 01.01.1970 was a Thursday
+    uint8_t day = 1 + (rule.weekday + 7 - firstWeekday) % 7 + (rule.week - 1) * 7;
+    while (day > daysInMonth(year, rule.month))
+        day -= 7;
+    return (time_t)(first + day - 1) * 86400 + rule.time - offset;
+}
+
+// "CET" or "<+03>"
+const char *LocalClock::parseName(const char *s)
+{
+    const char *start = s;
+    if (*s == '<')
+    {
+        s = strchr(s, '>');
+        return s ? s + 1 : nullptr;
+    }
+    while (isalpha(*s))
+        s++;
+    return (s > start) ? s : nullptr;
+}
+
+// [+|-]hh[:mm[:ss]] in seconds
+const char *LocalClock::parseOffset(const char *s, int32_t &seconds)
+{
+    int32_t sign = 1;
+    if ((*s == '+') || (*s == '-'))
+        sign = (*s++ == '-') ? -1 : 1;
+    int32_t value;
+    s = parseNumber(s, value);
+    if (!s)
+        return nullptr;
+    seconds = value * 3600;
+    if (*s == ':')
+    {
+        s = parseNumber(s + 1, value);
+        if (!s)
+            return nullptr;
+        seconds += value * 60;
+        if (*s == ':')
+        {
+            s = parseNumber(s + 1, value);
+            if (!s)
+                return nullptr;
+            seconds += value;
+        }
+    }
+    seconds *= sign;
+    return s;
+}
+
+// Mm.w.d[/time]
+const char *LocalClock::parseRule(const char *s, rule_s &rule)
+{
+    int32_t month, week, weekday;
+    if ((*s != 'M') || !(s = parseNumber(s + 1, month)) || (*s != '.') ||
+        !(s = parseNumber(s + 1, week)) || (*s != '.') || !(s = parseNumber(s + 1, weekday)))
+        return nullptr;
+    if ((month < 1) || (month > 12) || (week < 1) || (week > 5) || (weekday > 6))
+        return nullptr;
+    rule.month = month;
+    rule.week = week;
+    rule.weekday = weekday;
+    rule.time = 2 * 3600;
+    if (*s == '/')
+        s = parseOffset(s + 1, rule.time);
+    return s;
+}
+
+// Days since 01.01.1970 (proleptic Gregorian calendar).
+int32_t LocalClock::daysFromCivil(int16_t year, uint8_t month, uint8_t day)
+{
+    year -= (month <= 2);
+    int32_t era = (year >= 0 ? year : year - 399) / 400;
+    uint32_t yearOfEra = year - era * 400;
+    uint32_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    uint32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (int32_t)dayOfEra - 719468;
+}
+
+uint8_t LocalClock::daysInMonth(int16_t year, uint8_t month)
+{
+    static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if ((month == 2) && (((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0)))
+        return 29;
+    return days[month - 1];
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+#include "Configuration.h"
+
+// Local time without localtime(). The broken-down time is advanced by one
+// second at a time and only computed in full after a jump of the system time
+// (NTP, time set on the web page), at a DST change or at the new year. The
+// DST changes of the year are computed once from the POSIX TZ string.
+// Without a TZ string (or with rules other than "Mm.w.d") localtime() is
+// used once a second.
+class LocalClock
+{
+public:
+    LocalClock();
+
+    boolean begin(const char *timezone);
+    boolean update();
+    boolean update(time_t now);
+    const struct tm &getTime();
+    uint32_t getRecalculations();
+
+private:
+    // Day "weekday" (0 = Sunday) of week "week" (1 to 5, 5 = last) of "month" (1 to 12)
+    struct rule_s
+    {
+        uint8_t month;
+        uint8_t week;
+        uint8_t weekday;
+        int32_t time; // Seconds after local midnight
+    };
+
+    boolean hasRules;
+    boolean hasDst;
+    int32_t stdOffset; // Seconds east of UTC
+    int32_t dstOffset;
+    rule_s dstStart;
+    rule_s dstEnd;
+
+    int16_t tableYear;
+    time_t dstStartTime; // UTC, in tableYear
+    time_t dstEndTime;
+    time_t nextChange; // UTC of the next DST change or new year
+
+    boolean valid;
+    time_t lastTime;
+    struct tm tmNow;
+    uint32_t recalculations;
+
+    void calculate(time_t now);
+    void advance();
+    void calculateTable(int16_t year);
+    time_t getRuleTime(int16_t year, const rule_s &rule, int32_t offset);
+    static const char *parseName(const char *s);
+    static const char *parseOffset(const char *s, int32_t &seconds);
+    static const char *parseRule(const char *s, rule_s &rule);
+    static int32_t daysFromCivil(int16_t year, uint8_t month, uint8_t day);
+    static uint8_t daysInMonth(int16_t year, uint8_t month);
+};
@@ -55,9 +55,15 @@ inline Mode& operator++(Mode& eDOW, int)
     return eDOW;
 }
 
+// See the table in Transitions.cpp.
 enum eTransition
 {
-    TRANSITION_NORMAL, // 0
-    TRANSITION_MOVEUP, // 1
-    TRANSITION_FADE    // 2
+    TRANSITION_NORMAL,     // 0
+    TRANSITION_MOVEUP,     // 1
+    TRANSITION_FADE,       // 2
+    TRANSITION_WIPE,       // 3
+    TRANSITION_TYPEWRITER, // 4
+    TRANSITION_MATRIX,     // 5
+    TRANSITION_CROSSFADE,  // 6
+    TRANSITION_COUNT
 };
\ No newline at end of file
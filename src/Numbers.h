@@ -1,79 +1,5 @@
 #pragma once
 
-const char numbers[][5] =
-{
-	{ // 0
-		0b00011110,
-		0b00010010,
-		0b00010010,
-		0b00010010,
-		0b00011110
-	},
-	{ // 1
-		0b00000100,
-		0b00001100,
-		0b00000100,
-		0b00000100,
-		0b00001110
-	},
-	{ // 2
-		0b00011110,
-		0b00000010,
-		0b00011110,
-		0b00010000,
-		0b00011110
-	},
-	{ // 3
-		0b00011110,
-		0b00000010,
-		0b00001110,
-		0b00000010,
-		0b00011110
-	},
-	{ // 4
-		0b00010010,
-		0b00010010,
-		0b00011110,
-		0b00000010,
-		0b00000010
-	},
-	{ // 5
-		0b00011110,
-		0b00010000,
-		0b00011110,
-		0b00000010,
-		0b00011110
-	},
-	{ // 6
-		0b00011110,
-		0b00010000,
-		0b00011110,
-		0b00010010,
-		0b00011110
-	},
-	{ // 7
-		0b00011110,
-		0b00000010,
-		0b00000100,
-		0b00000100,
-		0b00000100
-	},
-	{ // 8
-		0b00011110,
-		0b00010010,
-		0b00011110,
-		0b00010010,
-		0b00011110
-	},
-	{ // 9
-		0b00011110,
-		0b00010010,
-		0b00011110,
-		0b00000010,
-		0b00011110
-	}
-};
-
 const char numbersBig[][7] =
 {
 	{ // 0
@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Profiler.cpp
+//*****************************************************************************
+
+#include "Profiler.h"
+
+#ifdef DEBUG_PROFILER
+
+static const char *sectionNames[PROFILE_SECTIONS] = {"loop", "render", "pixels", "show", "transition"};
+
+Profiler::Profiler()
+{
+    reset();
+}
+
+void Profiler::start(eProfilerSection section)
+{
+    sections[section].startCycles = ESP.getCycleCount();
+}
+
+// The cycle counter wraps after 53 s at 80 MHz. Unsigned math handles one wrap.
+void Profiler::stop(eProfilerSection section)
+{
+    section_s &s = sections[section];
+    uint32_t cycles = ESP.getCycleCount() - s.startCycles;
+    s.samples[s.nextSample] = cycles;
+    s.nextSample = (s.nextSample + 1) % PROFILER_SAMPLES;
+    s.count++;
+    if (cycles > s.maxCycles)
+        s.maxCycles = cycles;
+}
+
+void Profiler::reset()
+{
+    memset(sections, 0, sizeof(sections));
+}
+
+// Min, avg, max and histogram of the last samples in us, max since reset.
+String Profiler::getReport()
+{
+    const uint32_t cyclesPerUs = ESP.getCpuFreqMHz();
+    char line[128];
+    String report;
+    snprintf(line, sizeof(line), "%-10s %7s %7s %7s %7s %7s | %5s %5s %5s %5s %5s %5s\n",
+             "section", "count", "min", "avg", "max", "peak", "<10u", "<100u", "<1m", "<10m", "<100m", "more");
+    report += line;
+    for (uint8_t i = 0; i < PROFILE_SECTIONS; i++)
+    {
+        const section_s &s = sections[i];
+        uint8_t samples = (s.count < PROFILER_SAMPLES) ? s.count : PROFILER_SAMPLES;
+        uint32_t minUs = samples ? UINT32_MAX : 0;
+        uint32_t maxUs = 0;
+        uint64_t sumUs = 0;
+        uint8_t histogram[PROFILER_BUCKETS] = {};
+        for (uint8_t j = 0; j < samples; j++)
+        {
+            uint32_t us = s.samples[j] / cyclesPerUs;
+            minUs = min(minUs, us);
+            maxUs = max(maxUs, us);
+            sumUs += us;
+            uint8_t bucket = 0;
+            for (uint32_t limit = 10; (us >= limit) && (bucket < PROFILER_BUCKETS - 1); limit *= 10)
+                bucket++;
+            histogram[bucket]++;
+        }
+        snprintf(line, sizeof(line), "%-10s %7lu %7lu %7lu %7lu %7lu | %5u %5u %5u %5u %5u %5u\n",
+                 sectionNames[i], (unsigned long)s.count, (unsigned long)minUs,
+                 (unsigned long)(samples ? sumUs / samples : 0), (unsigned long)maxUs,
+                 (unsigned long)(s.maxCycles / cyclesPerUs),
+                 histogram[0], histogram[1], histogram[2], histogram[3], histogram[4], histogram[5]);
+        report += line;
+    }
+    return report;
+}
+
+#endif
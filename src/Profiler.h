@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Arduino.h>
+#include "Configuration.h"
+
+// Sections of the display pipeline which are measured.
+enum eProfilerSection : uint8_t {
+    PROFILE_LOOP,       // One run of loop()
+    PROFILE_RENDER,     // Rendering the screenbuffer
+    PROFILE_PIXELS,     // Writing the screenbuffer to the LED driver
+    PROFILE_SHOW,       // Sending a frame to the LEDs
+    PROFILE_TRANSITION, // A step of a transition
+    PROFILE_SECTIONS
+};
+
+#ifdef DEBUG_PROFILER
+
+#define PROFILER_SAMPLES 64 // Last samples kept for each section
+#define PROFILER_BUCKETS 6  // Histogram: <10us, <100us, <1ms, <10ms, <100ms, more
+
+class Profiler
+{
+public:
+    Profiler();
+
+    void start(eProfilerSection section);
+    void stop(eProfilerSection section);
+    void reset();
+    String getReport();
+
+private:
+    struct section_s
+    {
+        uint32_t startCycles;
+        uint32_t samples[PROFILER_SAMPLES]; // Ring buffer in CPU cycles
+        uint8_t nextSample;
+        uint32_t count;
+        uint32_t maxCycles; // Since reset
+    } sections[PROFILE_SECTIONS];
+};
+
+extern Profiler profiler;
+
+#define PROFILER_START(section) profiler.start(section)
+#define PROFILER_STOP(section) profiler.stop(section)
+#else
+#define PROFILER_START(section)
+#define PROFILER_STOP(section)
+#endif
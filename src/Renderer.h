@@ -1,11 +1,10 @@
 #pragma once
 
 #include <Arduino.h>
+#include "Colors.h"
 #include "Configuration.h"
 #include "Languages.h"
-#include "Letters.h"
 #include "Numbers.h"
-#include "Words.h"
 
 enum eTextPos : uint8_t {
     TEXT_POS_TOP,
@@ -13,33 +12,125 @@ enum eTextPos : uint8_t {
     TEXT_POS_BOTTOM = 5
 };
 
+// All front covers are built in, one is selected in the settings.
+enum eFrontCover : uint8_t {
+    COVER_EN,
+    COVER_DE_DE,
+    COVER_DE_SW,
+    COVER_DE_BA,
+    COVER_DE_SA,
+    COVER_DE_MKF_DE,
+    COVER_DE_MKF_SW,
+    COVER_DE_MKF_BA,
+    COVER_DE_MKF_SA,
+    COVER_D3,
+    COVER_CH,
+    COVER_CH_GS,
+    COVER_ES,
+    COVER_FR,
+    COVER_IT,
+    COVER_NL,
+    COVER_COUNT
+};
+
+// The front cover set in Configuration.h is the one after the first start.
+#if defined(FRONTCOVER_DE_DE)
+#define FRONTCOVER_DEFAULT COVER_DE_DE
+#elif defined(FRONTCOVER_DE_SW)
+#define FRONTCOVER_DEFAULT COVER_DE_SW
+#elif defined(FRONTCOVER_DE_BA)
+#define FRONTCOVER_DEFAULT COVER_DE_BA
+#elif defined(FRONTCOVER_DE_SA)
+#define FRONTCOVER_DEFAULT COVER_DE_SA
+#elif defined(FRONTCOVER_DE_MKF_DE)
+#define FRONTCOVER_DEFAULT COVER_DE_MKF_DE
+#elif defined(FRONTCOVER_DE_MKF_SW)
+#define FRONTCOVER_DEFAULT COVER_DE_MKF_SW
+#elif defined(FRONTCOVER_DE_MKF_BA)
+#define FRONTCOVER_DEFAULT COVER_DE_MKF_BA
+#elif defined(FRONTCOVER_DE_MKF_SA)
+#define FRONTCOVER_DEFAULT COVER_DE_MKF_SA
+#elif defined(FRONTCOVER_D3)
+#define FRONTCOVER_DEFAULT COVER_D3
+#elif defined(FRONTCOVER_CH)
+#define FRONTCOVER_DEFAULT COVER_CH
+#elif defined(FRONTCOVER_CH_GS)
+#define FRONTCOVER_DEFAULT COVER_CH_GS
+#elif defined(FRONTCOVER_ES)
+#define FRONTCOVER_DEFAULT COVER_ES
+#elif defined(FRONTCOVER_FR)
+#define FRONTCOVER_DEFAULT COVER_FR
+#elif defined(FRONTCOVER_IT)
+#define FRONTCOVER_DEFAULT COVER_IT
+#elif defined(FRONTCOVER_NL)
+#define FRONTCOVER_DEFAULT COVER_NL
+#else
+#define FRONTCOVER_DEFAULT COVER_EN
+#endif
+
+struct frontCover_s;
+
+// Icons of the modes, see Sprites.h.
+enum eSprite : uint8_t {
+    SPRITE_MOON,             // 8 phases, 0: new moon, 4: full moon
+    SPRITE_THERMOMETER = SPRITE_MOON + 8,
+    SPRITE_PLUS,
+    SPRITE_MINUS,
+    SPRITE_PERCENT,
+    SPRITE_HUNDRED,          // "100"
+    SPRITE_COUNT
+};
+
+// How a sprite is drawn into the screenbuffer.
+enum eBlitMode : uint8_t {
+    BLIT_OR,                 // Turn on the LEDs of the sprite
+    BLIT_AND_NOT             // Turn off the LEDs of the sprite
+};
+
+// A sprite in PROGMEM, its rows are left aligned like the screenbuffer.
+struct sprite_s
+{
+    uint16_t offset; // First row in spriteRows
+    uint8_t height;
+};
+
 class Renderer {
 
 public:
     Renderer();
 
-    void setHours(uint8_t hours, boolean glatt, uint16_t matrix[]);
+    void setFrontCover(uint8_t cover);
+    uint8_t getFrontCover();
+    static const char *getFrontCoverName(uint8_t cover);
+    void getWeekday(uint8_t weekday, char text[3]);
     void setTime(uint8_t hours, uint8_t minutes, uint16_t matrix[]);
     void setCorners(uint8_t minutes, uint16_t matrix[]);
     void setAlarmLed(uint16_t matrix[]);
     void deactivateAlarmLed(uint16_t matrix[]);
+    void setEntryWords(uint16_t matrix[]);
     void clearEntryWords(uint16_t matrix[]);
-    void setSmallText(String menuText, eTextPos textPos, uint16_t matrix[]);
+    void setSmallText(const char *text, eTextPos textPos, uint16_t matrix[]);
+    void setSmallNumber(uint16_t number, eTextPos textPos, uint16_t matrix[], uint8_t digits = 1);
+    void setSprite(eSprite sprite, int8_t x, int8_t y, uint16_t matrix[], eBlitMode mode = BLIT_OR);
     void setAMPM(uint8_t hours, uint16_t matrix[]);
     void setPixelInScreenBuffer(uint8_t x, uint8_t y, uint16_t matrix[]);
     void unsetPixelInScreenBuffer(uint8_t x, uint8_t y, uint16_t matrix[]);
     void clearScreenBuffer(uint16_t matrix[]);
     void setAllScreenBuffer(uint16_t matrix[]);
 
+    // A color screenbuffer holds one color per LED (COLOR_NONE is off).
+    // LEDs are numbered like in the LedDriver: x + y * 11, corners 110 to 113, alarm 114.
+    void setColorScreenBuffer(uint16_t matrix[], uint8_t color, uint8_t colorMatrix[]);
+    void paintColorScreenBuffer(uint16_t matrix[], uint8_t color, uint8_t colorMatrix[]);
+    void clearColorScreenBuffer(uint8_t colorMatrix[]);
+
 private:
-    boolean isNumber(char symbol);
-#if defined(FRONTCOVER_FR)
-    void FR_hours(uint8_t hours, uint16_t matrix[]);
-#endif
-#if defined(FRONTCOVER_IT)
-    void IT_hours(uint8_t hours, uint16_t matrix[]);
-#endif
-#if defined(FRONTCOVER_ES)
-    void ES_hours(uint8_t hours, uint16_t matrix[]);
-#endif
+    uint8_t frontCover;
+    const frontCover_s *cover; // PROGMEM
+    const uint16_t (*frames)[10]; // PROGMEM
+    uint8_t frameHours;
+
+    void setWord(uint16_t word, uint16_t matrix[]);
+    void setSmallChar(uint16_t codepoint, uint8_t left, eTextPos textPos, uint16_t matrix[]);
+    boolean isNumber(uint16_t codepoint);
 };
\ No newline at end of file
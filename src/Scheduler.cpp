@@ -0,0 +1,278 @@
+//*****************************************************************************
+// Scheduler.cpp
+//*****************************************************************************
+
+#include "Scheduler.h"
+#include "Debug.h"
+#include "LocalClock.h"
+
+extern LocalClock localClock;
+
+Scheduler::Scheduler()
+{
+    taskCount = 0;
+    memset(&tmNow, 0, sizeof(tmNow));
+    started = false;
+    secondTime = 0;
+    maxSleep = 0;
+    awake = false;
+    wakeUpSet = false;
+    wakeUpTime = 0;
+    dutyStart = millis();
+    dutySleep = 0;
+    dutyCycle = 100;
+    resetStats();
+}
+
+void Scheduler::addTask(const char *name, void (*function)(), eTaskTrigger trigger, uint16_t interval, uint8_t priority)
+{
+    if (taskCount >= SCHEDULER_MAX_TASKS)
+    {
+        DEBUG_SERIAL_PRINTLN(F("[ERROR] Too many tasks"));
+        return;
+    }
+
+    // Keep the tasks sorted by priority.
+    uint8_t i = taskCount;
+    while (i && (tasks[i - 1].priority < priority))
+    {
+        tasks[i] = tasks[i - 1];
+        i--;
+    }
+    task_s &task = tasks[i];
+    memset(&task, 0, sizeof(task));
+    task.name = name;
+    task.function = function;
+    task.trigger = trigger;
+    task.interval = interval;
+    task.priority = priority;
+    task.dueTime = millis();
+    task.due = (trigger != TASK_PERIODIC);
+    taskCount++;
+}
+
+void Scheduler::run()
+{
+    uint32_t now = millis();
+
+    // The clock tasks are all due on the first run.
+    if (localClock.update() || !started)
+    {
+        boolean firstRun = !started;
+        struct tm tmLast = tmNow;
+        started = true;
+        secondTime = now;
+        tmNow = localClock.getTime();
+        for (uint8_t i = 0; i < taskCount; i++)
+        {
+            task_s &task = tasks[i];
+            boolean edge = firstRun;
+            switch (task.trigger)
+            {
+            case TASK_SECOND:
+                edge = true;
+                break;
+            case TASK_MINUTE:
+                edge |= (tmNow.tm_min != tmLast.tm_min) || (tmNow.tm_hour != tmLast.tm_hour);
+                break;
+            case TASK_HOUR:
+                edge |= (tmNow.tm_hour != tmLast.tm_hour);
+                break;
+            case TASK_DAY:
+                edge |= (tmNow.tm_mday != tmLast.tm_mday);
+                break;
+            default:
+                edge = false;
+                break;
+            }
+            if (edge && !task.due)
+            {
+                task.due = true;
+                task.dueTime = now;
+            }
+        }
+    }
+
+    boolean idle = true;
+    for (uint8_t i = 0; i < taskCount; i++)
+    {
+        task_s &task = tasks[i];
+        if (task.trigger == TASK_ALWAYS)
+            task.due = true;
+        if ((task.trigger == TASK_PERIODIC) && (millis() - task.dueTime >= task.interval))
+        {
+            task.dueTime += task.interval;
+            task.due = true;
+        }
+        if (!task.due)
+            continue;
+
+        task.due = false;
+        uint32_t start = micros();
+        uint32_t lateness = millis() - task.dueTime;
+        if (task.trigger == TASK_ALWAYS)
+            lateness = 0;
+        task.function();
+        uint32_t runTime = micros() - start;
+
+        task.runs++;
+        task.runTime += runTime;
+        task.maxRunTime = max(task.maxRunTime, runTime);
+        task.maxLateness = max(task.maxLateness, lateness);
+        if (lateness > getDeadline(task))
+        {
+            task.missed++;
+            // Start over instead of catching up on periods already missed.
+            if (task.trigger == TASK_PERIODIC)
+                task.dueTime = millis();
+        }
+        if (task.trigger != TASK_ALWAYS)
+        {
+            busyTime += runTime;
+            idle = false;
+        }
+    }
+
+    loops++;
+    if (idle)
+        idleLoops++;
+    if (idle && maxSleep && !awake)
+        sleep();
+    awake = false;
+    wakeUpSet = false;
+
+    uint32_t window = millis() - dutyStart;
+    if (window >= 10000)
+    {
+        dutyCycle = 100 - min((uint32_t)100, dutySleep / 10 / window);
+        dutyStart += window;
+        dutySleep = 0;
+    }
+}
+
+// Sleep until the next task is due, at most maxSleep ms. The TASK_ALWAYS tasks
+// (web server, OTA) run at least every maxSleep ms. delay() lets the WiFi
+// modem sleep and interrupts (buttons) still come in.
+void Scheduler::sleep()
+{
+    uint32_t now = millis();
+    uint32_t duration = maxSleep;
+    for (uint8_t i = 0; i < taskCount; i++)
+    {
+        const task_s &task = tasks[i];
+        if (task.trigger == TASK_PERIODIC)
+        {
+            uint32_t elapsed = now - task.dueTime;
+            duration = min(duration, (elapsed < task.interval) ? task.interval - elapsed : 0);
+        }
+        else if (task.trigger != TASK_ALWAYS)
+        {
+            // Wake up for the next second, then poll for it.
+            uint32_t elapsed = now - secondTime;
+            duration = min(duration, (elapsed < 1000) ? 1000 - elapsed : 1);
+        }
+    }
+    if (wakeUpSet)
+    {
+        int32_t left = wakeUpTime - now;
+        duration = min(duration, (left > 0) ? (uint32_t)left : 0);
+    }
+    if (!duration)
+        return;
+    uint32_t start = micros();
+    delay(duration);
+    dutySleep += micros() - start;
+}
+
+// Sleep up to maxSleep ms when no task is due. 0 turns sleeping off.
+void Scheduler::setIdleSleep(uint16_t maxSleep)
+{
+    this->maxSleep = maxSleep;
+}
+
+// Run the next loop without sleeping. For tasks with work in progress (transitions).
+void Scheduler::stayAwake()
+{
+    awake = true;
+}
+
+// Do not sleep past time (millis()) in this loop. For deadlines of a task
+// which are not in the scheduler (the steps of the feed).
+void Scheduler::wakeUpAt(uint32_t time)
+{
+    if (!wakeUpSet || ((int32_t)(time - wakeUpTime) < 0))
+        wakeUpTime = time;
+    wakeUpSet = true;
+}
+
+// Time a task may start late.
+uint32_t Scheduler::getDeadline(const task_s &task)
+{
+    switch (task.trigger)
+    {
+    case TASK_ALWAYS:
+        return UINT32_MAX;
+    case TASK_PERIODIC:
+        return task.interval;
+    default:
+        return 1000;
+    }
+}
+
+// The local time at the last change of the second.
+const struct tm &Scheduler::getTime()
+{
+    return tmNow;
+}
+
+// Percent of the time spent in tasks other than TASK_ALWAYS.
+uint8_t Scheduler::getLoad()
+{
+    uint32_t elapsed = millis() - statsStart;
+    if (!elapsed)
+        return 0;
+    return min((uint64_t)100, busyTime / 10 / elapsed);
+}
+
+// Percent of the time the CPU was awake in the last 10 s.
+uint8_t Scheduler::getDutyCycle()
+{
+    return dutyCycle;
+}
+
+void Scheduler::resetStats()
+{
+    for (uint8_t i = 0; i < taskCount; i++)
+    {
+        tasks[i].runs = 0;
+        tasks[i].runTime = 0;
+        tasks[i].maxRunTime = 0;
+        tasks[i].maxLateness = 0;
+        tasks[i].missed = 0;
+    }
+    statsStart = millis();
+    busyTime = 0;
+    loops = 0;
+    idleLoops = 0;
+}
+
+// Statistics of the tasks as a HTML table.
+String Scheduler::getReport()
+{
+    uint32_t elapsed = millis() - statsStart;
+    if (!elapsed)
+        elapsed = 1;
+    String message = "<table style=\"margin:auto;font-size:12px;text-align:right;\">"
+                     "<tr><th>Task</th><th>Prio</th><th>Runs</th><th>Avg us</th><th>Max us</th><th>Late ms</th><th>Missed</th><th>CPU %</th></tr>";
+    for (uint8_t i = 0; i < taskCount; i++)
+    {
+        const task_s &task = tasks[i];
+        message += "<tr><td>" + String(task.name) + "</td><td>" + String(task.priority) + "</td><td>" + String(task.runs) +
+                   "</td><td>" + String(task.runs ? (uint32_t)(task.runTime / task.runs) : 0) + "</td><td>" + String(task.maxRunTime) +
+                   "</td><td>" + String(task.maxLateness) + "</td><td>" + String(task.missed) +
+                   "</td><td>" + String((float)task.runTime / 10.0f / elapsed, 1) + "</td></tr>";
+    }
+    message += "</table>"
+               "Loops: " + String(loops) + ", idle: " + String(loops ? (uint32_t)((uint64_t)idleLoops * 100 / loops) : 0) + " %, load: " + String(getLoad()) + " %, duty cycle: " + String(getDutyCycle()) + " %";
+    return message;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+#include "Configuration.h"
+
+#define SCHEDULER_MAX_TASKS 16
+
+// When a task is due.
+enum eTaskTrigger : uint8_t {
+    TASK_ALWAYS,   // Every loop
+    TASK_PERIODIC, // Every interval ms
+    TASK_SECOND,   // When the second of the clock changes
+    TASK_MINUTE,   // When the minute changes
+    TASK_HOUR,     // When the hour changes
+    TASK_DAY       // When the day changes
+};
+
+// Cooperative scheduler. loop() calls run(), which runs the tasks that are due.
+// Tasks with a higher priority run first, tasks with the same priority in the
+// order they were added. A task must return quickly.
+class Scheduler
+{
+public:
+    Scheduler();
+
+    void addTask(const char *name, void (*function)(), eTaskTrigger trigger, uint16_t interval, uint8_t priority);
+    void run();
+    const struct tm &getTime();
+    void setIdleSleep(uint16_t maxSleep);
+    void stayAwake();
+    void wakeUpAt(uint32_t time);
+    uint8_t getLoad();
+    uint8_t getDutyCycle();
+    String getReport();
+    void resetStats();
+
+private:
+    struct task_s
+    {
+        const char *name;
+        void (*function)();
+        eTaskTrigger trigger;
+        uint16_t interval; // ms, TASK_PERIODIC only
+        uint8_t priority;
+        boolean due;
+        uint32_t dueTime; // millis() when the task became due
+        uint32_t runs;
+        uint64_t runTime; // us
+        uint32_t maxRunTime; // us
+        uint32_t maxLateness; // ms
+        uint32_t missed; // Deadlines missed
+    } tasks[SCHEDULER_MAX_TASKS];
+    uint8_t taskCount;
+
+    struct tm tmNow;
+    boolean started;
+    uint32_t secondTime; // millis() when the second last changed
+
+    uint16_t maxSleep; // ms, 0: never sleep
+    boolean awake; // A task needs the next loop right away
+    boolean wakeUpSet;
+    uint32_t wakeUpTime; // millis() a task needs the next loop at
+
+    uint32_t statsStart; // millis()
+    uint64_t busyTime; // us in tasks other than TASK_ALWAYS
+    uint32_t loops;
+    uint32_t idleLoops; // Loops which ran no task other than TASK_ALWAYS
+
+    uint32_t dutyStart; // millis() at the start of the duty cycle window
+    uint32_t dutySleep; // us slept in the window
+    uint8_t dutyCycle; // % of the last window
+
+    void sleep();
+
+    uint32_t getDeadline(const task_s &task);
+};
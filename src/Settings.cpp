@@ -3,6 +3,7 @@
 //*****************************************************************************
 
 #include "Settings.h"
+#include "Renderer.h"
 
 Settings::Settings() {
     // loadFromEEPROM();
@@ -24,6 +25,7 @@ void Settings::resetToDefault() {
     mySettings.color = WHITE;
     mySettings.colorChange = COLORCHANGE_NO;
     mySettings.transition = TRANSITION_FADE;
+    mySettings.transitionTime = 500;
     mySettings.timeout = 10;
     mySettings.modeChange = false;
     mySettings.itIs = true;
@@ -36,6 +38,7 @@ void Settings::resetToDefault() {
     mySettings.nightOffTime = 82800; // 23:00 * 3600
     mySettings.dayOnTime = 21600; // 06:00 * 3600
     mySettings.hourBeep = false;
+    mySettings.frontCover = FRONTCOVER_DEFAULT;
 #ifdef DEBUG
     DEBUG_SERIAL_PRINTLN(F("Default settings set"));
 #endif
@@ -9,7 +9,7 @@
 #include "Modes.h"
 
 #define SETTINGS_MAGIC_NUMBER 0x2B
-#define SETTINGS_VERSION 25
+#define SETTINGS_VERSION 27
 
 class Settings {
 public:
@@ -24,6 +24,7 @@ public:
         uint8_t color;
         uint8_t colorChange;
         uint8_t transition;
+        uint16_t transitionTime;
         uint8_t timeout;
         boolean modeChange;
         boolean itIs;
@@ -36,6 +37,7 @@ public:
         time_t  nightOffTime;
         time_t  dayOnTime;
         boolean hourBeep;
+        uint8_t frontCover;
     } mySettings;
 
     void loadFromEEPROM();
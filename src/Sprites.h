@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Renderer.h"
+
+// Sprites, sorted like eSprite. The rows of all sprites are stored one after
+// the other, left aligned: bit 15 is the leftmost column.
+static const uint16_t spriteRows[] PROGMEM = {
+    // new moon
+    0b0000111000000000,
+    0b0011000110000000,
+    0b0100000001000000,
+    0b0100000001000000,
+    0b1000000000100000,
+    0b1000000000100000,
+    0b0100000001000000,
+    0b0100000001000000,
+    0b0011000110000000,
+    0b0000111000000000,
+    // waxing crescent
+    0b0000111000000000,
+    0b0000001110000000,
+    0b0000000111000000,
+    0b0000000111000000,
+    0b0000000111100000,
+    0b0000000111100000,
+    0b0000000111000000,
+    0b0000000111000000,
+    0b0000001110000000,
+    0b0000111000000000,
+    // first quarter
+    0b0000011000000000,
+    0b0000011110000000,
+    0b0000011111000000,
+    0b0000011111000000,
+    0b0000011111100000,
+    0b0000011111100000,
+    0b0000011111000000,
+    0b0000011111000000,
+    0b0000011110000000,
+    0b0000011000000000,
+    // waxing gibbous
+    0b0000111000000000,
+    0b0001111110000000,
+    0b0001111111000000,
+    0b0001111111000000,
+    0b0001111111100000,
+    0b0001111111100000,
+    0b0001111111000000,
+    0b0001111111000000,
+    0b0001111110000000,
+    0b0000111000000000,
+    // full moon
+    0b0000111000000000,
+    0b0011111110000000,
+    0b0111111111000000,
+    0b0111111111000000,
+    0b1111111111100000,
+    0b1111111111100000,
+    0b0111111111000000,
+    0b0111111111000000,
+    0b0011111110000000,
+    0b0000111000000000,
+    // waning gibbous
+    0b0000111000000000,
+    0b0011111100000000,
+    0b0111111100000000,
+    0b0111111100000000,
+    0b1111111100000000,
+    0b1111111100000000,
+    0b0111111100000000,
+    0b0111111100000000,
+    0b0011111100000000,
+    0b0000111000000000,
+    // last quarter
+    0b0000110000000000,
+    0b0011110000000000,
+    0b0111110000000000,
+    0b0111110000000000,
+    0b1111110000000000,
+    0b1111110000000000,
+    0b0111110000000000,
+    0b0111110000000000,
+    0b0011110000000000,
+    0b0000110000000000,
+    // waning crescent
+    0b0000111000000000,
+    0b0011100000000000,
+    0b0111000000000000,
+    0b0111000000000000,
+    0b1111000000000000,
+    0b1111000000000000,
+    0b0111000000000000,
+    0b0111000000000000,
+    0b0011100000000000,
+    0b0000111000000000,
+    // thermometer
+    0b0100000000000000,
+    0b1010000000000000,
+    0b1010000000000000,
+    0b1110000000000000,
+    // plus
+    0b0100000000000000,
+    0b1110000000000000,
+    0b0100000000000000,
+    // minus
+    0b1110000000000000,
+    // percent
+    0b1001000000000000,
+    0b0010000000000000,
+    0b0100000000000000,
+    0b1001000000000000,
+    // 100
+    0b0101110111000000,
+    0b1101010101000000,
+    0b0101010101000000,
+    0b0101010101000000,
+    0b0101110111000000};
+
+static const sprite_s sprites[SPRITE_COUNT] PROGMEM = {
+    {0, 10}, // new moon
+    {10, 10}, // waxing crescent
+    {20, 10}, // first quarter
+    {30, 10}, // waxing gibbous
+    {40, 10}, // full moon
+    {50, 10}, // waning gibbous
+    {60, 10}, // last quarter
+    {70, 10}, // waning crescent
+    {80, 4}, // thermometer
+    {84, 3}, // plus
+    {87, 1}, // minus
+    {88, 4}, // percent
+    {92, 5}}; // 100
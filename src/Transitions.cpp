@@ -0,0 +1,574 @@
+//*****************************************************************************
+// Transitions.cpp
+//*****************************************************************************
+
+#include "Transitions.h"
+#include "Profiler.h"
+#include "Renderer.h"
+#include "Settings.h"
+
+extern LedDriver ledDriver;
+extern Renderer renderer;
+extern Settings settings;
+#ifdef BUZZER
+extern bool alarmTimerSet;
+#endif
+
+static void setScreenBufferPixels(uint16_t screenBuffer[], uint8_t color, uint8_t brightness);
+static void setColorScreenBufferPixels(uint8_t colorScreenBuffer[], uint8_t brightness);
+static boolean getAlarmPixel(uint16_t screenBuffer[], uint8_t color, uint8_t &num, uint8_t &alarmColor);
+
+// Color of the last screenbuffer written. Crossfades start from it.
+static uint8_t shownColor = WHITE;
+
+// The last screenbuffer written. rewriteScreenBuffer() sends it again.
+static uint16_t shownScreenBuffer[10];
+static uint8_t shownColors[NUMPIXELS];
+static boolean shownColored; // It was a color screenbuffer
+
+void writeScreenBuffer(uint16_t screenBuffer[], uint8_t color, uint8_t brightness)
+{
+    memmove(shownScreenBuffer, screenBuffer, sizeof(shownScreenBuffer));
+    shownColored = false;
+    PROFILER_START(PROFILE_PIXELS);
+    ledDriver.clear();
+    setScreenBufferPixels(screenBuffer, color, brightness);
+    PROFILER_STOP(PROFILE_PIXELS);
+    shownColor = color;
+    ledDriver.show();
+}
+
+// Set the LEDs of a screenbuffer. Does not clear or show the frame.
+static void setScreenBufferPixels(uint16_t screenBuffer[], uint8_t color, uint8_t brightness)
+{
+    for (uint8_t y = 0; y <= 9; y++)
+    {
+        for (uint8_t x = 0; x <= 10; x++)
+        {
+            if (bitRead(screenBuffer[y], 15 - x))
+            {
+                ledDriver.setPixel(x, y, color, brightness);
+            }
+        }
+    }
+
+    // Corner LEDs
+    for (uint8_t y = 0; y <= 3; y++)
+    {
+        if (bitRead(screenBuffer[y], 4))
+        {
+            ledDriver.setPixel(110 + y, color, brightness);
+        }
+    }
+
+    // Alarm LED
+    uint8_t num;
+    uint8_t alarmColor;
+    if (getAlarmPixel(screenBuffer, color, num, alarmColor))
+    {
+        ledDriver.setPixel(num, alarmColor, brightness);
+    }
+}
+
+// The LED and color which show the alarm LED of a screenbuffer. False if none.
+static boolean getAlarmPixel(uint16_t screenBuffer[], uint8_t color, uint8_t &num, uint8_t &alarmColor)
+{
+#ifdef BUZZER
+    if (!bitRead(screenBuffer[4], 4))
+        return false;
+    num = 114;
+    alarmColor = color;
+#ifdef ALARM_LED_COLOR
+    alarmColor = ALARM_LED_COLOR;
+#ifdef ABUSE_CORNER_LED_FOR_ALARM
+    num = 111;
+    if (!(settings.mySettings.alarm1 || settings.mySettings.alarm2 || alarmTimerSet))
+    {
+        if (!bitRead(screenBuffer[1], 4))
+            return false;
+        alarmColor = color;
+    }
+#endif
+#endif
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Write a screenbuffer with a color for each LED.
+// Use renderer.paintColorScreenBuffer() to give words different colors.
+void writeColorScreenBuffer(uint8_t colorScreenBuffer[], uint8_t brightness)
+{
+    memmove(shownColors, colorScreenBuffer, sizeof(shownColors));
+    shownColored = true;
+    PROFILER_START(PROFILE_PIXELS);
+    ledDriver.clear();
+    setColorScreenBufferPixels(colorScreenBuffer, brightness);
+    PROFILER_STOP(PROFILE_PIXELS);
+    ledDriver.show();
+}
+
+// Write the last screenbuffer again in its colors, e.g. with a new brightness.
+void rewriteScreenBuffer(uint8_t brightness)
+{
+    if (shownColored)
+        writeColorScreenBuffer(shownColors, brightness);
+    else
+        writeScreenBuffer(shownScreenBuffer, shownColor, brightness);
+}
+
+// Set the LEDs of a color screenbuffer. Does not clear or show the frame.
+static void setColorScreenBufferPixels(uint8_t colorScreenBuffer[], uint8_t brightness)
+{
+    for (uint8_t i = 0; i < NUMPIXELS; i++)
+    {
+        if (colorScreenBuffer[i] != COLOR_NONE)
+        {
+            ledDriver.setPixel(i, colorScreenBuffer[i], brightness);
+        }
+    }
+}
+
+//=============================================================================
+// Transitions
+//=============================================================================
+
+// A transition draws the steps from the old to the new screenbuffer.
+// begin() returns the number of steps (0 writes the new screenbuffer at once),
+// step() draws transition.step and done() draws the last step.
+struct transition_s
+{
+    const char *name;
+    uint8_t (*begin)();
+    void (*step)();
+    void (*done)();
+};
+
+// The running transition. handleTransition() draws its steps from loop().
+static struct
+{
+    boolean running;
+    const transition_s *effect;
+    uint16_t screenBufferOld[10];
+    uint16_t screenBufferNew[10];
+    uint8_t colorOld;
+    uint8_t color;
+    uint8_t brightness;
+    uint8_t step;
+    uint8_t steps;
+    uint32_t startTime;
+    uint16_t duration;
+    uint8_t columnDelay[11]; // Matrix rain
+    boolean colored; // Some LEDs have a color of their own
+    uint8_t colors[NUMPIXELS]; // Own colors of the LEDs, COLOR_NONE: color
+} transition;
+
+static uint8_t beginNormal();
+static uint8_t beginMoveUp();
+static void stepMoveUp();
+static uint8_t beginFade();
+static void stepFade();
+static uint8_t beginWipe();
+static void stepWipe();
+static uint8_t beginTypewriter();
+static void stepTypewriter();
+static uint8_t beginMatrixRain();
+static void stepMatrixRain();
+static uint8_t beginCrossfade();
+static void stepCrossfade();
+static void doneTransition();
+
+// In the order of eTransition.
+static const transition_s transitions[TRANSITION_COUNT] = {
+    {"none", beginNormal, nullptr, doneTransition},
+    {"move", beginMoveUp, stepMoveUp, doneTransition},
+    {"fade", beginFade, stepFade, doneTransition},
+    {"wipe", beginWipe, stepWipe, doneTransition},
+    {"typewriter", beginTypewriter, stepTypewriter, doneTransition},
+    {"matrix", beginMatrixRain, stepMatrixRain, doneTransition},
+    {"crossfade", beginCrossfade, stepCrossfade, doneTransition}};
+
+// Name of a transition for the settings page.
+const char *getTransitionName(uint8_t type)
+{
+    return (type < TRANSITION_COUNT) ? transitions[type].name : "";
+}
+
+// Start a transition from the old to the new screenbuffer. It takes
+// settings.mySettings.transitionTime ms and does not block. The LEDs which
+// are not COLOR_NONE in colors keep that color, e.g. words painted with
+// renderer.paintColorScreenBuffer().
+void startTransition(uint8_t type, uint16_t screenBufferOld[], uint16_t screenBufferNew[], uint8_t color, uint8_t brightness, uint8_t colors[])
+{
+    transition.running = false;
+    transition.effect = &transitions[(type < TRANSITION_COUNT) ? type : TRANSITION_NORMAL];
+    memcpy(transition.screenBufferOld, screenBufferOld, sizeof(transition.screenBufferOld));
+    memcpy(transition.screenBufferNew, screenBufferNew, sizeof(transition.screenBufferNew));
+    transition.colorOld = shownColor;
+    transition.color = color;
+    transition.colored = (colors != nullptr);
+    if (colors)
+        memcpy(transition.colors, colors, sizeof(transition.colors));
+    transition.brightness = brightness;
+    transition.step = 0;
+    transition.steps = brightness ? transition.effect->begin() : 0;
+    if (!transition.steps)
+    {
+        doneTransition();
+        return;
+    }
+    transition.startTime = millis();
+    transition.duration = settings.mySettings.transitionTime;
+    transition.running = true;
+}
+
+// Draw the next step of the running transition if it is due.
+// Steps are skipped if the loop falls behind, the duration stays the same.
+void handleTransition(uint8_t brightness)
+{
+    if (!transition.running)
+        return;
+
+    transition.brightness = brightness;
+    uint32_t elapsed = millis() - transition.startTime;
+    uint8_t step = transition.steps;
+    if (elapsed < transition.duration)
+        step = elapsed * transition.steps / transition.duration;
+    if (step == transition.step)
+        return;
+    transition.step = step;
+
+    PROFILER_START(PROFILE_TRANSITION);
+    if (transition.step < transition.steps)
+        transition.effect->step();
+    else
+    {
+        transition.effect->done();
+        transition.running = false;
+    }
+    PROFILER_STOP(PROFILE_TRANSITION);
+}
+
+// End the running transition where it is. Whatever is written next replaces it.
+void stopTransition()
+{
+    transition.running = false;
+}
+
+boolean isTransitionRunning()
+{
+    return transition.running;
+}
+
+// Color of a LED in a step: its own color or the color of the transition.
+static uint8_t getPixelColor(uint8_t num, uint8_t color)
+{
+    return (transition.colored && (transition.colors[num] != COLOR_NONE)) ? transition.colors[num] : color;
+}
+
+// Color screenbuffer of a step: the LEDs of screenBuffer in the color of the
+// transition or their own color in colors, the alarm LED like writeScreenBuffer().
+static void getStepColors(uint16_t screenBuffer[], uint8_t colors[], uint8_t colorScreenBuffer[])
+{
+    renderer.setColorScreenBuffer(screenBuffer, transition.color, colorScreenBuffer);
+    for (uint8_t i = 0; i < NUMPIXELS; i++)
+    {
+        if ((colorScreenBuffer[i] != COLOR_NONE) && (colors[i] != COLOR_NONE))
+            colorScreenBuffer[i] = colors[i];
+    }
+    uint8_t num;
+    uint8_t alarmColor;
+    colorScreenBuffer[114] = COLOR_NONE;
+    if (getAlarmPixel(screenBuffer, transition.color, num, alarmColor))
+        colorScreenBuffer[num] = alarmColor;
+}
+
+// Write a step of the transition. colors are the own colors of its LEDs.
+static void writeStep(uint16_t screenBuffer[], uint8_t colors[])
+{
+    if (!transition.colored)
+    {
+        writeScreenBuffer(screenBuffer, transition.color, transition.brightness);
+        return;
+    }
+    uint8_t colorScreenBuffer[NUMPIXELS];
+    getStepColors(screenBuffer, colors, colorScreenBuffer);
+    writeColorScreenBuffer(colorScreenBuffer, transition.brightness);
+    shownColor = transition.color;
+}
+
+static void doneTransition()
+{
+    writeStep(transition.screenBufferNew, transition.colors);
+}
+
+//-----------------------------------------------------------------------------
+// None
+//-----------------------------------------------------------------------------
+
+static uint8_t beginNormal()
+{
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Move up: the new screenbuffer moves in from below, one line per step.
+//-----------------------------------------------------------------------------
+
+static uint8_t beginMoveUp()
+{
+    return 10;
+}
+
+static void stepMoveUp()
+{
+    uint16_t screenBuffer[10];
+    for (uint8_t y = 0; y <= 9; y++)
+    {
+        uint8_t line = y + transition.step;
+        screenBuffer[y] = (line <= 9) ? transition.screenBufferOld[line] : transition.screenBufferNew[line - 10];
+    }
+
+    // Own colors move up with the lines.
+    uint8_t colors[NUMPIXELS];
+    if (transition.colored)
+    {
+        memcpy(colors, transition.colors, sizeof(colors));
+        for (uint8_t y = 0; y <= 9; y++)
+            memcpy(&colors[y * 11], &transition.colors[((y + transition.step) % 10) * 11], 11);
+    }
+    writeStep(screenBuffer, colors);
+}
+
+//-----------------------------------------------------------------------------
+// Fade: pixels which turn on get brighter, pixels which turn off get darker.
+//-----------------------------------------------------------------------------
+
+static uint8_t beginFade()
+{
+    return TRANSITION_FADE_FRAMES;
+}
+
+// Brightness which fades in at the current step. Interpolated linearly,
+// the brightness table of the LED driver makes it look even.
+static uint8_t getBrightnessIn()
+{
+    return ((uint16_t)transition.brightness * transition.step + transition.steps / 2) / transition.steps;
+}
+
+// Brightness of a pixel in the current step of the fade.
+static uint8_t getFadeBrightness(uint8_t y, uint8_t bit)
+{
+    boolean on = bitRead(transition.screenBufferOld[y], bit);
+    boolean onNew = bitRead(transition.screenBufferNew[y], bit);
+    uint8_t brightnessIn = getBrightnessIn();
+    if (on && onNew)
+        return transition.brightness;
+    if (onNew)
+        return brightnessIn;
+    if (on)
+        return transition.brightness - brightnessIn;
+    return 0;
+}
+
+// Alarm LED in a step of a fade, like setScreenBufferPixels() sets it.
+// Call it after the corner LEDs.
+static void setFadeAlarmPixel(uint8_t color)
+{
+#ifdef BUZZER
+    uint8_t alarmBrightness = getFadeBrightness(4, 4);
+#ifdef ALARM_LED_COLOR
+#ifdef ABUSE_CORNER_LED_FOR_ALARM
+    if (settings.mySettings.alarm1 || settings.mySettings.alarm2 || alarmTimerSet)
+    {
+        ledDriver.setPixel(111, ALARM_LED_COLOR, alarmBrightness);
+    }
+#else
+    ledDriver.setPixel(114, ALARM_LED_COLOR, alarmBrightness);
+#endif
+#else
+    ledDriver.setPixel(114, color, alarmBrightness);
+#endif
+#endif
+}
+
+static void stepFade()
+{
+    uint8_t color = transition.color;
+    ledDriver.clear();
+    for (uint8_t y = 0; y <= 9; y++)
+    {
+        for (uint8_t x = 0; x <= 10; x++)
+        {
+            uint8_t brightness = getFadeBrightness(y, 15 - x);
+            if (brightness)
+                ledDriver.setPixel(x, y, getPixelColor(x + y * 11, color), brightness);
+        }
+    }
+
+    // Corner LEDs
+    for (uint8_t y = 0; y <= 3; y++)
+    {
+        uint8_t brightness = getFadeBrightness(y, 4);
+        if (brightness)
+            ledDriver.setPixel(110 + y, getPixelColor(110 + y, color), brightness);
+    }
+
+    setFadeAlarmPixel(color);
+    shownColor = color;
+    ledDriver.show();
+}
+
+//-----------------------------------------------------------------------------
+// Wipe: the new screenbuffer replaces the old one column by column.
+//-----------------------------------------------------------------------------
+
+static uint8_t beginWipe()
+{
+    return 11;
+}
+
+static void stepWipe()
+{
+    // Columns 0 to step - 1 and the left corners are new.
+    uint16_t columns = ~(0xFFFF >> transition.step);
+    uint16_t screenBuffer[10];
+    for (uint8_t y = 0; y <= 9; y++)
+    {
+        uint16_t mask = columns;
+        if ((y == 0) || (y == 3))
+            mask |= 0b0000000000010000;
+        screenBuffer[y] = (transition.screenBufferNew[y] & mask) | (transition.screenBufferOld[y] & ~mask);
+    }
+    writeStep(screenBuffer, transition.colors);
+}
+
+//-----------------------------------------------------------------------------
+// Typewriter: the old letters go, the new ones are typed one by one.
+//-----------------------------------------------------------------------------
+
+static uint8_t getNewLetters()
+{
+    uint8_t letters = 0;
+    for (uint8_t y = 0; y <= 9; y++)
+    {
+        uint16_t newLetters = transition.screenBufferNew[y] & ~transition.screenBufferOld[y] & 0b1111111111100000;
+        while (newLetters)
+        {
+            newLetters &= newLetters - 1;
+            letters++;
+        }
+    }
+    return letters;
+}
+
+static uint8_t beginTypewriter()
+{
+    return getNewLetters() + 1;
+}
+
+static void stepTypewriter()
+{
+    // Letters which stay are shown from the start.
+    uint16_t screenBuffer[10];
+    uint8_t letters = transition.step;
+    for (uint8_t y = 0; y <= 9; y++)
+    {
+        screenBuffer[y] = transition.screenBufferOld[y] & transition.screenBufferNew[y];
+        for (uint8_t x = 0; x <= 10; x++)
+        {
+            if (letters && bitRead(transition.screenBufferNew[y], 15 - x) && !bitRead(transition.screenBufferOld[y], 15 - x))
+            {
+                bitSet(screenBuffer[y], 15 - x);
+                letters--;
+            }
+        }
+    }
+    writeStep(screenBuffer, transition.colors);
+}
+
+//-----------------------------------------------------------------------------
+// Matrix rain: a drop falls down each column and leaves the new letters behind.
+//-----------------------------------------------------------------------------
+
+#define MATRIX_RAIN_DELAY 10 // Maximum delay of a column in steps
+#define MATRIX_RAIN_TAIL 3   // Length of the tail of a drop
+
+static uint8_t beginMatrixRain()
+{
+    for (uint8_t x = 0; x <= 10; x++)
+        transition.columnDelay[x] = random(0, MATRIX_RAIN_DELAY);
+    return MATRIX_RAIN_DELAY + 10 + MATRIX_RAIN_TAIL;
+}
+
+static void stepMatrixRain()
+{
+    uint16_t screenBuffer[10];
+    memcpy(screenBuffer, transition.screenBufferOld, sizeof(screenBuffer));
+    for (uint8_t x = 0; x <= 10; x++)
+    {
+        int8_t head = transition.step - transition.columnDelay[x];
+        for (uint8_t y = 0; (y <= 9) && ((int8_t)y < head); y++)
+            bitWrite(screenBuffer[y], 15 - x, bitRead(transition.screenBufferNew[y], 15 - x));
+    }
+
+    ledDriver.clear();
+    if (transition.colored)
+    {
+        uint8_t colorScreenBuffer[NUMPIXELS];
+        getStepColors(screenBuffer, transition.colors, colorScreenBuffer);
+        setColorScreenBufferPixels(colorScreenBuffer, transition.brightness);
+    }
+    else
+        setScreenBufferPixels(screenBuffer, transition.color, transition.brightness);
+    for (uint8_t x = 0; x <= 10; x++)
+    {
+        int8_t head = transition.step - transition.columnDelay[x];
+        for (uint8_t i = 0; i < MATRIX_RAIN_TAIL; i++)
+        {
+            int8_t y = head - i;
+            if ((y >= 0) && (y <= 9) && !bitRead(screenBuffer[y], 15 - x))
+                ledDriver.setPixel(x, y, getPixelColor(x + y * 11, transition.color), transition.brightness >> i);
+        }
+    }
+    ledDriver.show();
+}
+
+//-----------------------------------------------------------------------------
+// Crossfade: like fade, pixels which stay on change from the old color to the new.
+//-----------------------------------------------------------------------------
+
+static uint8_t beginCrossfade()
+{
+    return TRANSITION_FADE_FRAMES;
+}
+
+static void stepCrossfade()
+{
+    uint8_t brightnessIn = getBrightnessIn();
+    uint8_t brightnessOut = transition.brightness - brightnessIn;
+    uint8_t mix = (uint16_t)255 * transition.step / transition.steps;
+    ledDriver.clear();
+    for (uint8_t num = 0; num < 114; num++)
+    {
+        uint8_t y = (num < 110) ? num / 11 : num - 110;
+        uint8_t bit = (num < 110) ? 15 - num % 11 : 4;
+        boolean on = bitRead(transition.screenBufferOld[y], bit);
+        boolean onNew = bitRead(transition.screenBufferNew[y], bit);
+        uint8_t color = getPixelColor(num, transition.color);
+        if (on && onNew && (color != transition.color))
+            ledDriver.setPixel(num, color, transition.brightness); // Keeps its own color
+        else if (on && onNew)
+            ledDriver.setPixelMix(num, transition.colorOld, transition.color, mix, transition.brightness);
+        else if (on)
+            ledDriver.setPixel(num, transition.colorOld, brightnessOut);
+        else if (onNew)
+            ledDriver.setPixel(num, color, brightnessIn);
+    }
+    setFadeAlarmPixel(transition.color);
+
+    // A crossfade which is stopped halfway is taken as the color it is closer to.
+    shownColor = (mix < 128) ? transition.colorOld : transition.color;
+    ledDriver.show();
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Arduino.h>
+#include "Colors.h"
+#include "Configuration.h"
+#include "LedDriver.h"
+#include "Modes.h"
+
+void writeScreenBuffer(uint16_t screenBuffer[], uint8_t color, uint8_t brightness);
+void writeColorScreenBuffer(uint8_t colorScreenBuffer[], uint8_t brightness);
+void rewriteScreenBuffer(uint8_t brightness);
+
+// Non-blocking transitions. Call handleTransition() from loop().
+void startTransition(uint8_t type, uint16_t screenBufferOld[], uint16_t screenBufferNew[], uint8_t color, uint8_t brightness, uint8_t colors[] = nullptr);
+void handleTransition(uint8_t brightness);
+void stopTransition();
+boolean isTransitionRunning();
+const char *getTransitionName(uint8_t type);
@@ -1,10 +1,17 @@
 #include "Configuration.h"
 #include "WebServer.h"
 #include "Helpers.h"
+#include "LedDriver.h"
+#include "LocalClock.h"
 #include "MeteoWeather.h"
 #include "Events.h"
+#include "Feed.h"
 #include "Settings.h"
 #include "Languages.h"
+#include "Profiler.h"
+#include "Renderer.h"
+#include "Scheduler.h"
+#include "Transitions.h"
 #include "Debug.h"
 
 //=============================================================================
@@ -22,9 +29,7 @@ extern uint8_t moonphase;
 extern time_t upTime;
 
 // Feed
-extern String feedText;
-extern uint8_t feedColor;
-extern uint8_t feedPosition;
+extern Feed feed;
 
 // MeteoWeather
 #ifdef WEATHER
@@ -55,6 +60,18 @@ extern IPAddress myIP;
 // Screenbuffer
 extern bool screenBufferNeedsUpdate;
 
+// LED driver
+extern LedDriver ledDriver;
+
+// Local time
+extern LocalClock localClock;
+
+// Scheduler
+extern Scheduler scheduler;
+
+// Renderer
+extern Renderer renderer;
+
 // Settings (from main.cpp)
 extern Settings settings;
 
@@ -101,6 +118,10 @@ void WebServerClass::setup()
               { handleShowText(); });
     server.on("/control", [this]()
               { handleControl(); });
+#ifdef DEBUG_PROFILER
+    server.on("/profiler", [this]()
+              { handleProfiler(); });
+#endif
     server.begin();
 }
 
@@ -222,9 +243,14 @@ String WebServerClass::generateRootPage()
                "<br><a href=\"https://www.buymeacoffee.com/ch570512\" target=\"_blank\"><img src=\"https://cdn.buymeacoffee.com/buttons/v2/default-yellow.png\" alt=\"Buy Me A Coffee\" style=\"height: 40px !important;width: 150px !important;\"></a>"
                "<br>Firmware: " +
                String(FIRMWARE_VERSION);
+    message += "<br>LEDs: " + String(ledDriver.getCurrent()) + " mA";
+#ifdef POWER_LIMIT_MA
+    message += " (limit " + String(POWER_LIMIT_MA) + " mA)";
+#endif
+    message += "<br>CPU duty cycle: " + String(scheduler.getDutyCycle()) + " %";
 
 #ifdef DEBUG_WEB
-    struct tm tmNow = getTime();
+    const struct tm &tmNow = localClock.getTime();
     char timeBuffer[20];
     snprintf(timeBuffer, sizeof(timeBuffer), "<br><br>Time: %02d:%02d",
              tmNow.tm_hour, tmNow.tm_min);
@@ -239,6 +265,8 @@ String WebServerClass::generateRootPage()
     message += "<br>Moonphase: " + String(moonphase);
     message += "<br>Free Heap: " + String(ESP.getFreeHeap() / 1024.0f) + " kB";
     message += "<br>RSSI: " + String(WiFi.RSSI());
+    message += "<br>Frames: " + String(ledDriver.getShownFrames()) + " shown, " + String(ledDriver.getSkippedFrames()) + " skipped";
+    message += "<br>" + scheduler.getReport();
 #ifdef LDR
     message += "<br>Brightness: " + String(brightness) + " (ABC: ";
     settings.mySettings.useAbc ? message += "enabled)" : message += "disabled)";
@@ -676,21 +704,48 @@ String WebServerClass::generateSettingsPage()
                "</td></tr>";
     // ------------------------------------------------------------------------
 #ifndef FRONTCOVER_BINARY
+    message += "<tr><td>"
+               "Front cover"
+               "</td><td>"
+               "<select name=\"fc\">";
+    for (int i = 0; i < COVER_COUNT; i++)
+    {
+        message += "<option value=\"" + String(i) + "\"";
+        if (i == settings.mySettings.frontCover)
+            message += " selected";
+        message += ">";
+        message += String(Renderer::getFrontCoverName(i)) + "</option>";
+    }
+    message += "</select>"
+               "</td></tr>";
+    // ------------------------------------------------------------------------
     message += "<tr><td>"
                "Transition"
+               "</td><td>";
+    for (int i = TRANSITION_COUNT - 1; i >= 0; i--)
+    {
+        message += "<input type=\"radio\" name=\"tr\" value=\"" + String(i) + "\"";
+        if (i == settings.mySettings.transition)
+            message += " checked";
+        message += "> ";
+        message += getTransitionName(i);
+        message += " ";
+    }
+    message += "</td></tr>";
+    // ------------------------------------------------------------------------
+    message += "<tr><td>"
+               "Transition time"
                "</td><td>"
-               "<input type=\"radio\" name=\"tr\" value=\"2\"";
-    if (settings.mySettings.transition == 2)
-        message += " checked";
-    message += "> fade "
-               "<input type=\"radio\" name=\"tr\" value=\"1\"";
-    if (settings.mySettings.transition == 1)
-        message += " checked";
-    message += "> move "
-               "<input type=\"radio\" name=\"tr\" value=\"0\"";
-    if (settings.mySettings.transition == 0)
-        message += " checked";
-    message += "> none"
+               "<select name=\"tt\">";
+    for (int i = 250; i <= 2000; i += 250)
+    {
+        message += "<option value=\"" + String(i) + "\"";
+        if (i == settings.mySettings.transitionTime)
+            message += " selected";
+        message += ">";
+        message += String(i) + " ms</option>";
+    }
+    message += "</select>"
                "</td></tr>";
 #endif
     // ------------------------------------------------------------------------
@@ -865,17 +920,15 @@ void WebServerClass::handleCommitSettings()
         break;
     }
     // ------------------------------------------------------------------------
-    switch (server.arg("tr").toInt())
+    if ((server.arg("tr").toInt() >= 0) && (server.arg("tr").toInt() < TRANSITION_COUNT))
+        settings.mySettings.transition = server.arg("tr").toInt();
+    if (server.hasArg("tt"))
+        settings.mySettings.transitionTime = constrain(server.arg("tt").toInt(), 250, 2000);
+    // ------------------------------------------------------------------------
+    if (server.hasArg("fc") && (server.arg("fc").toInt() >= 0) && (server.arg("fc").toInt() < COVER_COUNT))
     {
-    case 0:
-        settings.mySettings.transition = TRANSITION_NORMAL;
-        break;
-    case 1:
-        settings.mySettings.transition = TRANSITION_MOVEUP;
-        break;
-    case 2:
-        settings.mySettings.transition = TRANSITION_FADE;
-        break;
+        settings.mySettings.frontCover = server.arg("fc").toInt();
+        renderer.setFrontCover(settings.mySettings.frontCover);
     }
     // ------------------------------------------------------------------------
     settings.mySettings.timeout = server.arg("to").toInt();
@@ -904,7 +957,7 @@ void WebServerClass::handleSetEvent()
 {
     events[0].day = server.arg("day").toInt();
     events[0].month = server.arg("month").toInt();
-    events[0].text = server.arg("text").substring(0, 40);
+    events[0].text = substringUtf8(server.arg("text"), 40);
     events[0].color = (eColor)server.arg("color").toInt();
     server.send(200, "text/plain", "OK.");
     DEBUG_SERIAL_PRINTLN(F("Event set: ") + String(events[0].day) + "." + String(events[0].month) + F(". ") + events[0].text);
@@ -919,11 +972,24 @@ void WebServerClass::handleShowText()
 #ifdef BUZZER
     uint8_t feedBuzzer = server.arg("buzzer").toInt();
 #endif
-    feedColor = server.arg("color").toInt();
-    feedText = "  " + server.arg("text").substring(0, 80) + "   ";
-    feedPosition = 0;
+    uint16_t feedSpeed = FEED_SPEED;
+    if (server.hasArg("speed"))
+        feedSpeed = constrain(server.arg("speed").toInt(), 20, 1000);
+    uint8_t feedPriority = FEED_PRIORITY_NORMAL;
+    if (server.hasArg("priority"))
+        feedPriority = constrain(server.arg("priority").toInt(), FEED_PRIORITY_LOW, FEED_PRIORITY_HIGH);
+    uint8_t feedRepeat = 1;
+    if (server.hasArg("repeat"))
+        feedRepeat = constrain(server.arg("repeat").toInt(), 1, 10);
+    String feedText = substringUtf8(server.arg("text"), 80);
+    if (!feed.add(feedText.c_str(), server.arg("color").toInt(), (eFeedPriority)feedPriority,
+                  feedRepeat, server.arg("expiry").toInt(), feedSpeed))
+    {
+        server.send(503, "text/plain", "Queue is full.");
+        return;
+    }
     server.send(200, "text/plain", "OK.");
-    DEBUG_SERIAL_PRINTLN(F("Show text: ") + server.arg("text").substring(0, 80));
+    DEBUG_SERIAL_PRINTLN(F("Show text: ") + feedText);
 
 #ifdef BUZZER
     for (uint8_t i = 0; i < feedBuzzer; i++)
@@ -935,7 +1001,8 @@ void WebServerClass::handleShowText()
     }
 #endif
 
-    setMode(MODE_FEED);
+    if (mode != MODE_FEED)
+        setMode(MODE_FEED);
 }
 
 //=============================================================================
@@ -947,3 +1014,16 @@ void WebServerClass::handleControl()
     setMode((Mode)server.arg("mode").toInt());
     server.send(200, "text/plain", "OK.");
 }
+
+//=============================================================================
+// Page /profiler
+//=============================================================================
+
+#ifdef DEBUG_PROFILER
+void WebServerClass::handleProfiler()
+{
+    server.send(200, "text/plain", profiler.getReport());
+    if (server.hasArg("reset"))
+        profiler.reset();
+}
+#endif
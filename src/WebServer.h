@@ -25,6 +25,9 @@ private:
     void handleSetEvent();
     void handleShowText();
     void handleControl();
+#ifdef DEBUG_PROFILER
+    void handleProfiler();
+#endif
     void callRoot();
     void handleButtonOnOff();
     void handleButtonMode();
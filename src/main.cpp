@@ -33,12 +33,18 @@
 #include "Colors.h"
 #include "Configuration.h"
 #include "Events.h"
+#include "Feed.h"
 #include "Helpers.h"
+#include "Input.h"
 #include "LedDriver.h"
+#include "LocalClock.h"
 #include "MeteoWeather.h"
 #include "Modes.h"
+#include "Profiler.h"
 #include "Renderer.h"
+#include "Scheduler.h"
 #include "Settings.h"
+#include "Transitions.h"
 #include "WebServer.h"
 
 // Event definitions
@@ -56,12 +62,19 @@ void buttonTimeInterrupt();
 void buttonTimePressed();
 uint8_t getBrightnessFromLDR();
 void getRoomConditions();
-void moveScreenBufferUp(uint16_t screenBufferOld[], uint16_t screenBufferNew[], uint8_t color, uint8_t brightness);
 void setLedsOff();
 void setLedsOn();
+void handleInput(eInputSource source, eInputGesture gesture);
 void setMode(Mode newMode);
-void writeScreenBuffer(uint16_t screenBuffer[], uint8_t color, uint8_t brightness);
-void writeScreenBufferFade(uint16_t screenBufferOld[], uint16_t screenBufferNew[], uint8_t color, uint8_t brightness);
+void taskDay();
+void taskDisplay();
+void taskHour();
+void taskInput();
+void taskIr();
+void taskLdr();
+void taskLeds();
+void taskMinute();
+void taskSecond();
 
 //=============================================================================
 // Init
@@ -92,10 +105,28 @@ Renderer renderer;
 // Settings
 Settings settings;
 
+// Local time
+LocalClock localClock;
+
+// Scheduler
+Scheduler scheduler;
+
+// Buttons and IR
+Input input;
+
+// Profiler
+#ifdef DEBUG_PROFILER
+Profiler profiler;
+#endif
+
 // Screenbuffer
 uint16_t matrix[10] = {};
 uint16_t matrixOld[10] = {};
 bool screenBufferNeedsUpdate = true;
+bool screenBufferNeedsRefresh = false; // Waits for a running transition
+#ifdef ENTRY_WORDS_COLOR
+uint8_t entryWordsColors[NUMPIXELS]; // Own colors of the time
+#endif
 
 // Mode
 Mode mode = MODE_TIME;
@@ -106,10 +137,6 @@ bool runTransitionOnce = false;
 uint8_t autoMode = 0;
 
 // Time
-uint8_t lastDay = 0;
-uint8_t lastMinute = 0;
-uint8_t lastHour = 0;
-uint8_t lastSecond = 0;
 uint8_t randomHour = 0;
 uint8_t randomMinute = 0;
 uint8_t moonphase = 0;
@@ -121,9 +148,7 @@ const char *monthOfYear[] = {
     "July", "August", "September", "October", "November", "December"};
 
 // Feed
-String feedText = "";
-uint8_t feedColor = WHITE;
-uint8_t feedPosition = 0;
+Feed feed;
 
 // MeteoWeather
 #ifdef WEATHER
@@ -141,7 +166,6 @@ uint8_t maxBrightness = 0;
 uint8_t brightness = 0;
 #ifdef LDR
 uint8_t iTargetBrightness = 0;
-unsigned long iBrightnessMillis = 0;
 #endif
 
 // Alarm
@@ -159,7 +183,6 @@ uint32_t showEventTimer = EVENT_TIME;
 
 // Misc
 IPAddress myIP = {0, 0, 0, 0};
-uint32_t lastButtonPress = 0;
 bool testFlag = false;
 uint8_t testColumn = 0;
 #ifdef DEBUG_FPS
@@ -174,6 +197,7 @@ void setup()
 {
     // Init serial port
     Serial.begin(115200);
+    ledDriver.begin();
     delay(1000);
 
     // And the monkey flips the switch. (Akiva Goldsman)
@@ -184,6 +208,7 @@ void setup()
 
     // Load settings
     settings.loadFromEEPROM();
+    renderer.setFrontCover(settings.mySettings.frontCover);
     maxBrightness = map(settings.mySettings.brightness, 0, 100, MIN_BRIGHTNESS, MAX_BRIGHTNESS);
     brightness = maxBrightness;
 
@@ -212,19 +237,19 @@ void setup()
 #ifdef MODE_BUTTON
     DEBUG_SERIAL_PRINTLN(F("Setting up Mode-Button."));
     pinMode(PIN_MODE_BUTTON, INPUT_PULLUP);
-    attachInterrupt(digitalPinToInterrupt(PIN_MODE_BUTTON), buttonModeInterrupt, FALLING);
+    attachInterrupt(digitalPinToInterrupt(PIN_MODE_BUTTON), buttonModeInterrupt, CHANGE);
 #endif
 
 #ifdef ONOFF_BUTTON
     DEBUG_SERIAL_PRINTLN(F("Setting up Back-Button."));
     pinMode(PIN_ONOFF_BUTTON, INPUT_PULLUP);
-    attachInterrupt(digitalPinToInterrupt(PIN_ONOFF_BUTTON), buttonOnOffInterrupt, FALLING);
+    attachInterrupt(digitalPinToInterrupt(PIN_ONOFF_BUTTON), buttonOnOffInterrupt, CHANGE);
 #endif
 
 #ifdef TIME_BUTTON
     DEBUG_SERIAL_PRINTLN(F("Setting up Time-Button."));
     pinMode(PIN_TIME_BUTTON, INPUT_PULLUP);
-    attachInterrupt(digitalPinToInterrupt(PIN_TIME_BUTTON), buttonTimeInterrupt, FALLING);
+    attachInterrupt(digitalPinToInterrupt(PIN_TIME_BUTTON), buttonTimeInterrupt, CHANGE);
 #endif
 
 #ifdef BUZZER
@@ -287,6 +312,7 @@ void setup()
 
         // Configure NTP-Client
         configTime(NTP_TIMEZONE, NTP_SERVER);
+        localClock.begin(NTP_TIMEZONE);
         DEBUG_SERIAL_PRINTLN("NTP Server: " + String(NTP_SERVER));
         DEBUG_SERIAL_PRINTLN("NTP Timezone: " + String(NTP_TIMEZONE));
         time_t now_time_t = time(nullptr);
@@ -314,11 +340,9 @@ void setup()
 #endif
 
 #ifdef SHOW_IP
-    // WiFi.isConnected() ? feedText = "  IP: " : feedText = "  AP-IP: ";
-    feedText = "  IP: ";
-    feedText += String(myIP[0]) + "." + String(myIP[1]) + "." + String(myIP[2]) + "." + String(myIP[3]) + "   ";
-    feedPosition = 0;
-    feedColor = WHITE;
+    char ipText[24];
+    snprintf(ipText, sizeof(ipText), "IP: %u.%u.%u.%u", myIP[0], myIP[1], myIP[2], myIP[3]);
+    feed.add(ipText, WHITE, FEED_PRIORITY_HIGH);
     mode = MODE_FEED;
 #endif
 
@@ -351,6 +375,34 @@ void setup()
 #ifdef FRONTCOVER_BINARY
     settings.mySettings.transition = TRANSITION_NORMAL;
 #endif
+
+    // Tasks of loop(). Priority 3: network and LEDs, 2: clock, 1: inputs, 0: display.
+#ifdef WEBSERVER
+    scheduler.addTask("web", []() { webServer.handle(); }, TASK_ALWAYS, 0, 3);
+#endif
+#ifdef ARDUINO_OTA
+    scheduler.addTask("ota", []() { ArduinoOTA.handle(); }, TASK_ALWAYS, 0, 3);
+#endif
+    scheduler.addTask("leds", taskLeds, TASK_ALWAYS, 0, 3);
+    scheduler.addTask("day", taskDay, TASK_DAY, 0, 2);
+    scheduler.addTask("hour", taskHour, TASK_HOUR, 0, 2);
+    scheduler.addTask("minute", taskMinute, TASK_MINUTE, 0, 2);
+    scheduler.addTask("second", taskSecond, TASK_SECOND, 0, 2);
+#ifdef LDR
+    scheduler.addTask("ldr", taskLdr, TASK_PERIODIC, 40, 1);
+#endif
+#ifdef IR_RECEIVER
+    scheduler.addTask("ir", taskIr, TASK_ALWAYS, 0, 1);
+#endif
+#if defined(ONOFF_BUTTON) || defined(MODE_BUTTON) || defined(TIME_BUTTON) || defined(IR_RECEIVER)
+    input.setHandler(handleInput);
+    scheduler.addTask("input", taskInput, TASK_ALWAYS, 0, 1);
+#endif
+    scheduler.addTask("display", taskDisplay, TASK_ALWAYS, 0, 0);
+#ifdef IDLE_SLEEP_MS
+    WiFi.setSleepMode(WIFI_MODEM_SLEEP);
+    scheduler.setIdleSleep(IDLE_SLEEP_MS);
+#endif
 }
 
 //=============================================================================
@@ -359,342 +411,365 @@ void setup()
 
 void loop()
 {
-    // Call HTTP-handle
-#ifdef WEBSERVER
-    webServer.handle();
-#endif
+    PROFILER_START(PROFILE_LOOP);
 
-    // Call OTA-handle
-#ifdef ARDUINO_OTA
-    ArduinoOTA.handle();
+    // Run the tasks which are due
+    scheduler.run();
+
+#ifdef DEBUG_FPS
+    // debugFps();
+    fps++;
 #endif
 
-    // Get the time from ESP
-    struct tm tmNow = getTime();
+    PROFILER_STOP(PROFILE_LOOP);
+}
 
-    //=============================================================================
-    // Run once a day
-    //=============================================================================
+//=============================================================================
+// Send a frame which had to wait for the LEDs and draw the next step of a transition
+//=============================================================================
 
-    if (tmNow.tm_mday != lastDay)
-    {
-        lastDay = tmNow.tm_mday;
-        screenBufferNeedsUpdate = true;
+void taskLeds()
+{
+    ledDriver.handle();
+    handleTransition(brightness);
+    // Stay awake until a frame which had to wait is on the LEDs.
+    if (isTransitionRunning() || ledDriver.isFrameInFlight())
+        scheduler.stayAwake();
+}
+
+//=============================================================================
+// Run once a day
+//=============================================================================
+
+void taskDay()
+{
+    screenBufferNeedsUpdate = true;
 
 #ifdef SHOW_MODE_MOONPHASE
-        int currentYear = tmNow.tm_year + 1900; // Convert 124 -> 2024
-        int currentMonth = tmNow.tm_mon + 1;    // Convert 9 -> 10 (October)
-        int currentDay = tmNow.tm_mday;         // This is already 1-31
-        moonphase = getMoonphase(currentYear, currentMonth, currentDay);
+    const struct tm &tmNow = scheduler.getTime();
+    int currentYear = tmNow.tm_year + 1900; // Convert 124 -> 2024
+    int currentMonth = tmNow.tm_mon + 1;    // Convert 9 -> 10 (October)
+    int currentDay = tmNow.tm_mday;         // This is already 1-31
+    moonphase = getMoonphase(currentYear, currentMonth, currentDay);
 #endif
 
-        // Reset URL event 0
-        events[0].day = 0;
-        events[0].month = 0;
+    // Reset URL event 0
+    events[0].day = 0;
+    events[0].month = 0;
 
-        // Change color
-        if (settings.mySettings.colorChange == COLORCHANGE_DAY)
-        {
-            settings.mySettings.color = random(0, COLORCHANGE_COUNT + 1);
+    // Change color
+    if (settings.mySettings.colorChange == COLORCHANGE_DAY)
+    {
+        settings.mySettings.color = random(0, COLORCHANGE_COUNT + 1);
 #ifdef DEBUG
-            Serial.printf("Color changed to: %u\n", settings.mySettings.color);
+        Serial.printf("Color changed to: %u\n", settings.mySettings.color);
 #endif
-        }
     }
+}
 
-    //=============================================================================
-    // Run once every hour
-    //=============================================================================
+//=============================================================================
+// Run once every hour
+//=============================================================================
 
-    if (tmNow.tm_hour != lastHour)
-    {
-        lastHour = tmNow.tm_hour;
-        screenBufferNeedsUpdate = true;
+void taskHour()
+{
+    const struct tm &tmNow = scheduler.getTime();
+    screenBufferNeedsUpdate = true;
 
-        // Change color
-        if (settings.mySettings.colorChange == COLORCHANGE_HOUR)
-        {
-            settings.mySettings.color = random(0, COLOR_COUNT + 1);
+    // Change color
+    if (settings.mySettings.colorChange == COLORCHANGE_HOUR)
+    {
+        settings.mySettings.color = random(0, COLOR_COUNT + 1);
 #ifdef DEBUG
-            Serial.printf("Color changed to: %u\n", (int)settings.mySettings.color);
+        Serial.printf("Color changed to: %u\n", (int)settings.mySettings.color);
 #endif
-        }
+    }
 
-        // Hourly beep
+    // Hourly beep
 #ifdef BUZZER
-        if ((settings.mySettings.hourBeep == true) && (mode == MODE_TIME))
-        {
-            digitalWrite(PIN_BUZZER, HIGH);
-            delay(25);
-            digitalWrite(PIN_BUZZER, LOW);
-            DEBUG_SERIAL_PRINTLN("Beep!");
-        }
-#endif
-
-        //=============================================================================
-        // Run once every random hour (therefore once a day)
-        //=============================================================================
-
-        if (tmNow.tm_hour == randomHour)
-        {
-            randomHour = tmNow.tm_hour;
-        }
+    if ((settings.mySettings.hourBeep == true) && (mode == MODE_TIME))
+    {
+        digitalWrite(PIN_BUZZER, HIGH);
+        delay(25);
+        digitalWrite(PIN_BUZZER, LOW);
+        DEBUG_SERIAL_PRINTLN("Beep!");
     }
+#endif
 
     //=============================================================================
-    // Run once every minute
+    // Run once every random hour (therefore once a day)
     //=============================================================================
 
-    if (tmNow.tm_min != lastMinute)
+    if (tmNow.tm_hour == randomHour)
     {
-        lastMinute = tmNow.tm_min;
-        screenBufferNeedsUpdate = true;
+        randomHour = tmNow.tm_hour;
+    }
+}
+
+//=============================================================================
+// Run once every minute
+//=============================================================================
+
+void taskMinute()
+{
+    const struct tm &tmNow = scheduler.getTime();
+    screenBufferNeedsUpdate = true;
+
+#ifdef DEBUG_PROFILER
+    Serial.print(profiler.getReport());
+#endif
 
 #if defined(SENSOR_DHT22)
-        // Update room conditions
-        getRoomConditions();
+    // Update room conditions
+    getRoomConditions();
 #endif
 
 #ifdef BUZZER
-        // Switch on buzzer for alarm 1
-        if (settings.mySettings.alarm1 && (tmNow.tm_hour == getHour(settings.mySettings.alarm1Time)) && (tmNow.tm_min == getMinute(settings.mySettings.alarm1Time)) && bitRead(settings.mySettings.alarm1Weekdays, tmNow.tm_wday))
-        {
-            alarmOn = BUZZTIME_ALARM_1;
-            DEBUG_SERIAL_PRINTLN(F("Alarm1 on"));
-        }
+    // Switch on buzzer for alarm 1
+    if (settings.mySettings.alarm1 && (tmNow.tm_hour == getHour(settings.mySettings.alarm1Time)) && (tmNow.tm_min == getMinute(settings.mySettings.alarm1Time)) && bitRead(settings.mySettings.alarm1Weekdays, tmNow.tm_wday))
+    {
+        alarmOn = BUZZTIME_ALARM_1;
+        DEBUG_SERIAL_PRINTLN(F("Alarm1 on"));
+    }
 
-        // Switch on buzzer for alarm 2
-        if (settings.mySettings.alarm2 && (tmNow.tm_hour == getHour(settings.mySettings.alarm2Time)) && (tmNow.tm_min == getMinute(settings.mySettings.alarm1Time)) && bitRead(settings.mySettings.alarm2Weekdays, tmNow.tm_wday))
-        {
-            alarmOn = BUZZTIME_ALARM_2;
-            DEBUG_SERIAL_PRINTLN(F("Alarm2 on"));
-        }
+    // Switch on buzzer for alarm 2
+    if (settings.mySettings.alarm2 && (tmNow.tm_hour == getHour(settings.mySettings.alarm2Time)) && (tmNow.tm_min == getMinute(settings.mySettings.alarm1Time)) && bitRead(settings.mySettings.alarm2Weekdays, tmNow.tm_wday))
+    {
+        alarmOn = BUZZTIME_ALARM_2;
+        DEBUG_SERIAL_PRINTLN(F("Alarm2 on"));
+    }
 #endif
 
-        // Set night- and daymode
-        if ((tmNow.tm_hour == getHour(settings.mySettings.nightOffTime)) && (tmNow.tm_min == getMinute(settings.mySettings.nightOffTime)))
-        {
-            DEBUG_SERIAL_PRINTLN(F("Night off"));
-            setMode(MODE_BLANK);
-        }
-        if ((tmNow.tm_hour == getHour(settings.mySettings.dayOnTime)) && (tmNow.tm_min == getMinute(settings.mySettings.dayOnTime)))
-        {
-            DEBUG_SERIAL_PRINTLN(F("Day on"));
-            setMode(lastMode);
-        }
+    // Set night- and daymode
+    if ((tmNow.tm_hour == getHour(settings.mySettings.nightOffTime)) && (tmNow.tm_min == getMinute(settings.mySettings.nightOffTime)))
+    {
+        DEBUG_SERIAL_PRINTLN(F("Night off"));
+        setMode(MODE_BLANK);
+    }
+    if ((tmNow.tm_hour == getHour(settings.mySettings.dayOnTime)) && (tmNow.tm_min == getMinute(settings.mySettings.dayOnTime)))
+    {
+        DEBUG_SERIAL_PRINTLN(F("Day on"));
+        setMode(lastMode);
+    }
 
-        //=============================================================================
-        // Run once every random minute (once an hour)
-        //=============================================================================
+    //=============================================================================
+    // Run once every random minute (once an hour)
+    //=============================================================================
 
-        if (tmNow.tm_min == randomMinute)
-        {
+    if (tmNow.tm_min == randomMinute)
+    {
 #ifdef WEATHER
-            if (WiFi.isConnected())
-            {
-                // Get weather from MeteoWeather
-                !outdoorWeather.getOutdoorConditions(LATITUDE, LONGITUDE, TIMEZONE) ? errorCounterOutdoorWeather++ : errorCounterOutdoorWeather = 0;
-            }
-#endif
+        if (WiFi.isConnected())
+        {
+            // Get weather from MeteoWeather
+            !outdoorWeather.getOutdoorConditions(LATITUDE, LONGITUDE, TIMEZONE) ? errorCounterOutdoorWeather++ : errorCounterOutdoorWeather = 0;
         }
+#endif
+    }
 
-        //=============================================================================
-        // Run once every 5 minutes
-        //=============================================================================
+    //=============================================================================
+    // Run once every 5 minutes
+    //=============================================================================
 
-        if (tmNow.tm_min % 5 == 0)
+    if (tmNow.tm_min % 5 == 0)
+    {
+        // Change color
+        if (settings.mySettings.colorChange == COLORCHANGE_FIVE)
         {
-            // Change color
-            if (settings.mySettings.colorChange == COLORCHANGE_FIVE)
-            {
-                settings.mySettings.color = random(0, COLOR_COUNT + 1);
+            settings.mySettings.color = random(0, COLOR_COUNT + 1);
 #ifdef DEBUG
-                Serial.printf("Color changed to: %u\n", settings.mySettings.color);
+            Serial.printf("Color changed to: %u\n", settings.mySettings.color);
 #endif
-            }
         }
     }
+}
 
-    //=============================================================================
-    // Run once every second
-    //=============================================================================
+//=============================================================================
+// Run once every second
+//=============================================================================
 
-    if (tmNow.tm_sec != lastSecond)
-    {
-        lastSecond = tmNow.tm_sec;
-        upTime++;
+void taskSecond()
+{
+#if defined(BUZZER) || defined(EVENT_TIME)
+    const struct tm &tmNow = scheduler.getTime();
+#endif
+    upTime++;
 
 #ifdef DEBUG_FPS
-        Serial.printf("FPS: %u\n", fps);
-        fps = 0;
+    Serial.printf("FPS: %u\n", fps);
+    fps = 0;
 #endif
 #ifdef DEBUG_LDR
-        // Serial.printf("LDR:        min: %d max: %d actual: %d\n", minLdrValue, maxLdrValue, ldrValue);
-        Serial.printf("Brightness: min: %d max: %d target: %d actual: %d\n", MIN_BRIGHTNESS, maxBrightness, iTargetBrightness, brightness);
+    // Serial.printf("LDR:        min: %d max: %d actual: %d\n", minLdrValue, maxLdrValue, ldrValue);
+    Serial.printf("Brightness: min: %d max: %d target: %d actual: %d\n", MIN_BRIGHTNESS, maxBrightness, iTargetBrightness, brightness);
 #endif
 
 #ifdef BUZZER
-        // Make some noise
-        if (alarmOn)
+    // Make some noise
+    if (alarmOn)
+    {
+        alarmOn--;
+        digitalRead(PIN_BUZZER) ? digitalWrite(PIN_BUZZER, LOW) : digitalWrite(PIN_BUZZER, HIGH);
+        if (!alarmOn)
         {
-            alarmOn--;
-            digitalRead(PIN_BUZZER) ? digitalWrite(PIN_BUZZER, LOW) : digitalWrite(PIN_BUZZER, HIGH);
-            if (!alarmOn)
-            {
-                DEBUG_SERIAL_PRINTLN(F("Alarm: off"));
-                digitalWrite(PIN_BUZZER, LOW);
-                screenBufferNeedsUpdate = true;
-            }
+            DEBUG_SERIAL_PRINTLN(F("Alarm: off"));
+            digitalWrite(PIN_BUZZER, LOW);
+            screenBufferNeedsUpdate = true;
         }
+    }
 #endif
 
+    // The feed is drawn when its next step is due (taskDisplay).
 #ifdef FRONTCOVER_BINARY
-        if (mode != MODE_BLANK)
-            screenBufferNeedsUpdate = true;
+    if ((mode != MODE_BLANK) && (mode != MODE_FEED))
+        screenBufferNeedsRefresh = true;
 #else
-        // General Screenbuffer-Update every second.
-        // (not in MODE_TIME or MODE_BLANK because it will lock the ESP due to TRANSITION_FADE)
-        if ((mode != MODE_TIME) && (mode != MODE_BLANK))
-        {
-            screenBufferNeedsUpdate = true;
-        }
+    // General Screenbuffer-Update every second.
+    // (not in MODE_TIME or MODE_BLANK because it would restart the transition every second)
+    if ((mode != MODE_TIME) && (mode != MODE_BLANK) && (mode != MODE_FEED))
+    {
+        screenBufferNeedsRefresh = true;
+    }
 #endif
 
-        // Flash ESP LED
+    // Flash ESP LED
 #ifdef ESP_LED
-        digitalWrite(PIN_LED, !digitalRead(PIN_LED));
+    digitalWrite(PIN_LED, !digitalRead(PIN_LED));
 #endif
 
-        // Countdown timeralarm by one minute in the second it was activated
+    // Countdown timeralarm by one minute in the second it was activated
 #ifdef BUZZER
-        if (alarmTimer && alarmTimerSet && (alarmTimerSecond == tmNow.tm_sec))
-        {
-            alarmTimer--;
+    if (alarmTimer && alarmTimerSet && (alarmTimerSecond == tmNow.tm_sec))
+    {
+        alarmTimer--;
 #ifdef DEBUG
-            if (alarmTimer)
-            {
-                Serial.printf("Timeralarm in %u min.\n", alarmTimer);
-            }
-#endif
-        }
-        // Switch on buzzer for timer
-        if (!alarmTimer && alarmTimerSet)
+        if (alarmTimer)
         {
-            alarmTimerSet = false;
-            alarmOn = BUZZTIME_TIMER;
-            DEBUG_SERIAL_PRINTLN(F("Timeralarm: on"));
+            Serial.printf("Timeralarm in %u min.\n", alarmTimer);
         }
 #endif
+    }
+    // Switch on buzzer for timer
+    if (!alarmTimer && alarmTimerSet)
+    {
+        alarmTimerSet = false;
+        alarmOn = BUZZTIME_TIMER;
+        DEBUG_SERIAL_PRINTLN(F("Timeralarm: on"));
+    }
+#endif
 
-        // Auto switch modes
-        if (settings.mySettings.modeChange && (mode == MODE_TIME))
+    // Auto switch modes
+    if (settings.mySettings.modeChange && (mode == MODE_TIME))
+    {
+        autoModeChangeTimer--;
+        if (!autoModeChangeTimer)
         {
-            autoModeChangeTimer--;
-            if (!autoModeChangeTimer)
+            DEBUG_SERIAL_PRINTLN(F("Auto modechange (") + String(autoMode) + F(")"));
+            autoModeChangeTimer = AUTO_MODECHANGE_TIME;
+            switch (autoMode)
             {
-                DEBUG_SERIAL_PRINTLN(F("Auto modechange (") + String(autoMode) + F(")"));
-                autoModeChangeTimer = AUTO_MODECHANGE_TIME;
-                switch (autoMode)
-                {
-                case 0:
+            case 0:
 #ifdef WEATHER
-                    if (WiFi.isConnected())
-                    {
-                        setMode(MODE_EXT_TEMP);
-                    }
-                    else
-                    {
-                        WiFi.reconnect();
-                        setMode(MODE_EXT_TEMP);
-                    }
+                if (WiFi.isConnected())
+                {
+                    setMode(MODE_EXT_TEMP);
+                }
+                else
+                {
+                    WiFi.reconnect();
+                    setMode(MODE_EXT_TEMP);
+                }
 #endif
-                    autoMode = 1;
-                    break;
-                case 1:
+                autoMode = 1;
+                break;
+            case 1:
 #if defined(SENSOR_DHT22)
-                    setMode(MODE_TEMP);
+                setMode(MODE_TEMP);
 #else
 #ifdef WEATHER
-                    if (WiFi.isConnected())
-                    {
-                        setMode(MODE_EXT_TEMP);
-                    }
-                    else
-                    {
-                        WiFi.reconnect();
-                        setMode(MODE_EXT_TEMP);
-                    }
+                if (WiFi.isConnected())
+                {
+                    setMode(MODE_EXT_TEMP);
+                }
+                else
+                {
+                    WiFi.reconnect();
+                    setMode(MODE_EXT_TEMP);
+                }
 #endif
 #endif
-                    autoMode = 0;
-                    break;
-                }
+                autoMode = 0;
+                break;
             }
         }
+    }
 
-        // Show event in feed
+    // Show event in feed
 #ifdef EVENT_TIME
-        if (mode == MODE_TIME)
+    if (mode == MODE_TIME)
+    {
+        showEventTimer--;
+        if (!showEventTimer)
         {
-            showEventTimer--;
-            if (!showEventTimer)
+            showEventTimer = EVENT_TIME;
+            for (uint8_t i = 0; i < (sizeof(events) / sizeof(event_t)); i++)
             {
-                showEventTimer = EVENT_TIME;
-                for (uint8_t i = 0; i < (sizeof(events) / sizeof(event_t)); i++)
+                if ((tmNow.tm_mday == events[i].day) && (tmNow.tm_mon == events[i].month))
                 {
-                    if ((tmNow.tm_mday == events[i].day) && (tmNow.tm_mon == events[i].month))
+                    char eventText[FEED_MAX_CHARS + 1];
+                    if (events[i].year)
                     {
-                        if (events[i].year)
-                        {
-                            feedText = "  " + events[i].text + " (" + String(tmNow.tm_year - events[i].year) + ")   ";
-                        }
-                        else
-                        {
-                            feedText = "  " + events[i].text + "   ";
-                        }
-                        feedPosition = 0;
-                        feedColor = events[i].color;
-                        DEBUG_SERIAL_PRINTLN("Event: \"" + feedText + "\"");
-                        setMode(MODE_FEED);
+                        snprintf(eventText, sizeof(eventText), "%s (%d)", events[i].text.c_str(), tmNow.tm_year - events[i].year);
                     }
+                    else
+                    {
+                        snprintf(eventText, sizeof(eventText), "%s", events[i].text.c_str());
+                    }
+                    // Events come again after EVENT_TIME, do not let them pile up.
+                    feed.add(eventText, events[i].color, FEED_PRIORITY_LOW, 1, EVENT_TIME);
+                    DEBUG_SERIAL_PRINTLN("Event: \"" + String(eventText) + "\"");
+                    if (mode != MODE_FEED)
+                        setMode(MODE_FEED);
                 }
             }
         }
-#endif
     }
+#endif
+}
 
-    //=============================================================================
-    // Run always
-    //=============================================================================
-
-    // Make sure the textfeed is updated
-    if (mode == MODE_FEED)
-        screenBufferNeedsUpdate = true;
+//=============================================================================
+// Set brightness from LDR and update display at 25Hz
+//=============================================================================
 
-    // Set brightness from LDR and update display at 25Hz
 #ifdef LDR
-    if (settings.mySettings.useAbc)
+void taskLdr()
+{
+    if (settings.mySettings.useAbc && !testFlag)
     {
-        if ((millis() - iBrightnessMillis >= 40) && !testFlag)
+        iTargetBrightness = getBrightnessFromLDR();
+        if (brightness < iTargetBrightness)
         {
-            iBrightnessMillis = millis();
-            iTargetBrightness = getBrightnessFromLDR();
-            if (brightness < iTargetBrightness)
-            {
-                brightness++;
-                writeScreenBuffer(matrix, settings.mySettings.color, brightness);
-            }
-            if (brightness > iTargetBrightness)
-            {
-                brightness--;
-                writeScreenBuffer(matrix, settings.mySettings.color, brightness);
-            }
+            brightness++;
+            if (!isTransitionRunning())
+                rewriteScreenBuffer(brightness);
+        }
+        if (brightness > iTargetBrightness)
+        {
+            brightness--;
+            if (!isTransitionRunning())
+                rewriteScreenBuffer(brightness);
         }
     }
+}
 #endif
 
-    // Watch out for IR commands and handle them accordingly
+//=============================================================================
+// Watch out for IR commands and handle them accordingly
+//=============================================================================
+
 #ifdef IR_RECEIVER
+void taskIr()
+{
     if (irrecv.decode(&irDecodeResult))
     {
 #ifdef DEBUG_IR
@@ -705,23 +780,42 @@ void loop()
         switch (irDecodeResult.value)
         {
         case IR_CODE_ONOFF:
-            buttonOnOffPressed();
+            input.click(INPUT_ONOFF);
             break;
         case IR_CODE_TIME:
-            buttonTimePressed();
+            input.click(INPUT_TIME);
             break;
         case IR_CODE_MODE:
-            buttonModePressed();
+            input.click(INPUT_MODE);
             break;
         }
         irrecv.resume();
     }
+}
 #endif
 
+//=============================================================================
+// Render and write the screenbuffer
+//=============================================================================
+
+void taskDisplay()
+{
+    const struct tm &tmNow = scheduler.getTime();
+
+    // Scroll the textfeed
+    if ((mode == MODE_FEED) && feed.isDue())
+        screenBufferNeedsUpdate = true;
+
+    // The update every second does not cut a transition short, it waits for its end.
+    if (screenBufferNeedsRefresh && !isTransitionRunning())
+        screenBufferNeedsUpdate = true;
+
     // Render a new screenbuffer if needed
     if (screenBufferNeedsUpdate)
     {
         screenBufferNeedsUpdate = false;
+        screenBufferNeedsRefresh = false;
+        PROFILER_START(PROFILE_RENDER);
 
         // Save old screenbuffer (or not if it's the test pattern)
         if (testFlag)
@@ -757,6 +851,13 @@ void loop()
             renderer.setCorners(tmNow.tm_min, matrix);
             if (!settings.mySettings.itIs && ((tmNow.tm_min / 5) % 6))
                 renderer.clearEntryWords(matrix);
+#ifdef ENTRY_WORDS_COLOR
+            {
+                uint16_t entryWords[10] = {};
+                renderer.setEntryWords(entryWords);
+                renderer.setColorScreenBuffer(entryWords, ENTRY_WORDS_COLOR, entryWordsColors);
+            }
+#endif
 #endif
 #ifdef BUZZER
             if (settings.mySettings.alarm1 || settings.mySettings.alarm2 || alarmTimerSet)
@@ -785,27 +886,20 @@ void loop()
 
 #ifdef SHOW_MODE_WEEKDAY
         case MODE_WEEKDAY:
+        {
+            char weekday[3];
+            renderer.getWeekday(tmNow.tm_wday, weekday);
             renderer.clearScreenBuffer(matrix);
-            renderer.setSmallText(String(sWeekday[tmNow.tm_wday][0]) + String(sWeekday[tmNow.tm_wday][1]), TEXT_POS_MIDDLE, matrix);
+            renderer.setSmallText(weekday, TEXT_POS_MIDDLE, matrix);
             break;
+        }
 #endif
 
 #ifdef SHOW_MODE_DATE
         case MODE_DATE:
             renderer.clearScreenBuffer(matrix);
-
-            // Create buffers to hold the formatted strings (max 3 chars: "01")
-            char dayBuf[4];
-            char monBuf[4];
-
-            // Use snprintf for safe, heap-free formatting
-            // %02d means: integer, at least 2 digits wide, pad with '0'
-            snprintf(dayBuf, sizeof(dayBuf), "%02d", (uint8_t)tmNow.tm_mday);
-            snprintf(monBuf, sizeof(monBuf), "%02d", (uint8_t)tmNow.tm_mon + 1);
-
-            // Render the pre-formatted strings
-            renderer.setSmallText(dayBuf, TEXT_POS_TOP, matrix);
-            renderer.setSmallText(monBuf, TEXT_POS_BOTTOM, matrix);
+            renderer.setSmallNumber(tmNow.tm_mday, TEXT_POS_TOP, matrix, 2);
+            renderer.setSmallNumber(tmNow.tm_mon + 1, TEXT_POS_BOTTOM, matrix, 2);
 
             // Manual pixel overrides
             renderer.setPixelInScreenBuffer(5, 4, matrix);
@@ -817,105 +911,7 @@ void loop()
 #ifdef SHOW_MODE_MOONPHASE
         case MODE_MOONPHASE:
             renderer.clearScreenBuffer(matrix);
-            switch (moonphase)
-            {
-            case 0: // New moon
-                matrix[0] = 0b0000111000000000;
-                matrix[1] = 0b0011000110000000;
-                matrix[2] = 0b0100000001000000;
-                matrix[3] = 0b0100000001000000;
-                matrix[4] = 0b1000000000100000;
-                matrix[5] = 0b1000000000100000;
-                matrix[6] = 0b0100000001000000;
-                matrix[7] = 0b0100000001000000;
-                matrix[8] = 0b0011000110000000;
-                matrix[9] = 0b0000111000000000;
-                break;
-            case 1: // Waxing crescent
-                matrix[0] = 0b0000111000000000;
-                matrix[1] = 0b0000001110000000;
-                matrix[2] = 0b0000000111000000;
-                matrix[3] = 0b0000000111000000;
-                matrix[4] = 0b0000000111100000;
-                matrix[5] = 0b0000000111100000;
-                matrix[6] = 0b0000000111000000;
-                matrix[7] = 0b0000000111000000;
-                matrix[8] = 0b0000001110000000;
-                matrix[9] = 0b0000111000000000;
-                break;
-            case 2: // First quarter
-                matrix[0] = 0b0000011000000000;
-                matrix[1] = 0b0000011110000000;
-                matrix[2] = 0b0000011111000000;
-                matrix[3] = 0b0000011111000000;
-                matrix[4] = 0b0000011111100000;
-                matrix[5] = 0b0000011111100000;
-                matrix[6] = 0b0000011111000000;
-                matrix[7] = 0b0000011111000000;
-                matrix[8] = 0b0000011110000000;
-                matrix[9] = 0b0000011000000000;
-                break;
-            case 3: // Waxing gibbous
-                matrix[0] = 0b0000111000000000;
-                matrix[1] = 0b0001111110000000;
-                matrix[2] = 0b0001111111000000;
-                matrix[3] = 0b0001111111000000;
-                matrix[4] = 0b0001111111100000;
-                matrix[5] = 0b0001111111100000;
-                matrix[6] = 0b0001111111000000;
-                matrix[7] = 0b0001111111000000;
-                matrix[8] = 0b0001111110000000;
-                matrix[9] = 0b0000111000000000;
-                break;
-            case 4: // Full moon
-                matrix[0] = 0b0000111000000000;
-                matrix[1] = 0b0011111110000000;
-                matrix[2] = 0b0111111111000000;
-                matrix[3] = 0b0111111111000000;
-                matrix[4] = 0b1111111111100000;
-                matrix[5] = 0b1111111111100000;
-                matrix[6] = 0b0111111111000000;
-                matrix[7] = 0b0111111111000000;
-                matrix[8] = 0b0011111110000000;
-                matrix[9] = 0b0000111000000000;
-                break;
-            case 5: // Waning gibbous
-                matrix[0] = 0b0000111000000000;
-                matrix[1] = 0b0011111100000000;
-                matrix[2] = 0b0111111100000000;
-                matrix[3] = 0b0111111100000000;
-                matrix[4] = 0b1111111100000000;
-                matrix[5] = 0b1111111100000000;
-                matrix[6] = 0b0111111100000000;
-                matrix[7] = 0b0111111100000000;
-                matrix[8] = 0b0011111100000000;
-                matrix[9] = 0b0000111000000000;
-                break;
-            case 6: // Last quarter
-                matrix[0] = 0b0000110000000000;
-                matrix[1] = 0b0011110000000000;
-                matrix[2] = 0b0111110000000000;
-                matrix[3] = 0b0111110000000000;
-                matrix[4] = 0b1111110000000000;
-                matrix[5] = 0b1111110000000000;
-                matrix[6] = 0b0111110000000000;
-                matrix[7] = 0b0111110000000000;
-                matrix[8] = 0b0011110000000000;
-                matrix[9] = 0b0000110000000000;
-                break;
-            case 7: // Waning crescent
-                matrix[0] = 0b0000111000000000;
-                matrix[1] = 0b0011100000000000;
-                matrix[2] = 0b0111000000000000;
-                matrix[3] = 0b0111000000000000;
-                matrix[4] = 0b1111000000000000;
-                matrix[5] = 0b1111000000000000;
-                matrix[6] = 0b0111000000000000;
-                matrix[7] = 0b0111000000000000;
-                matrix[8] = 0b0011100000000000;
-                matrix[9] = 0b0000111000000000;
-                break;
-            }
+            renderer.setSprite((eSprite)(SPRITE_MOON + moonphase), 0, 0, matrix);
             break;
 #endif
 
@@ -923,38 +919,20 @@ void loop()
         case MODE_TEMP:
             DEBUG_SERIAL_PRINTLN(F("Room Temperature: ") + String(roomTemperature) + F(" °C"));
             renderer.clearScreenBuffer(matrix);
-            if (roomTemperature == 0)
-            {
-                matrix[0] = 0b0000000001000000;
-                matrix[1] = 0b0000000010100000;
-                matrix[2] = 0b0000000010100000;
-                matrix[3] = 0b0000000011100000;
-            }
+            renderer.setSprite(SPRITE_THERMOMETER, 8, 0, matrix);
             if (roomTemperature > 0)
-            {
-                matrix[0] = 0b0000000001000000;
-                matrix[1] = 0b0100000010100000;
-                matrix[2] = 0b1110000010100000;
-                matrix[3] = 0b0100000011100000;
-            }
+                renderer.setSprite(SPRITE_PLUS, 0, 1, matrix);
             if (roomTemperature < 0)
-            {
-                matrix[0] = 0b0000000001000000;
-                matrix[1] = 0b0000000010100000;
-                matrix[2] = 0b1110000010100000;
-                matrix[3] = 0b0000000011100000;
-            }
-            renderer.setSmallText(String(int(abs(roomTemperature) + 0.5)), TEXT_POS_BOTTOM, matrix);
+                renderer.setSprite(SPRITE_MINUS, 0, 2, matrix);
+            renderer.setSmallNumber(abs(roomTemperature) + 0.5, TEXT_POS_BOTTOM, matrix);
             break;
 
         case MODE_HUMIDITY:
             DEBUG_SERIAL_PRINTLN(F("Room Humidity: ") + String(roomHumidity) + F(" %rH"));
             renderer.clearScreenBuffer(matrix);
-            renderer.setSmallText(String(int(roomHumidity + 0.5)), TEXT_POS_TOP, matrix);
-            matrix[6] = 0b0100100001000000;
-            matrix[7] = 0b0001000010100000;
-            matrix[8] = 0b0010000010100000;
-            matrix[9] = 0b0100100011100000;
+            renderer.setSmallNumber(roomHumidity + 0.5, TEXT_POS_TOP, matrix);
+            renderer.setSprite(SPRITE_PERCENT, 1, 6, matrix);
+            renderer.setSprite(SPRITE_THERMOMETER, 8, 6, matrix);
             break;
 #endif
 
@@ -963,32 +941,19 @@ void loop()
             DEBUG_SERIAL_PRINTLN(F("Outdoor temperature: ") + String(outdoorWeather.temperature) + F(" °C"));
             renderer.clearScreenBuffer(matrix);
             if (outdoorWeather.temperature > 0)
-            {
-                matrix[1] = 0b0100000000000000;
-                matrix[2] = 0b1110000000000000;
-                matrix[3] = 0b0100000000000000;
-            }
+                renderer.setSprite(SPRITE_PLUS, 0, 1, matrix);
             if (outdoorWeather.temperature < 0)
-                matrix[2] = 0b1110000000000000;
-            renderer.setSmallText(String(int(abs(outdoorWeather.temperature) + 0.5)), TEXT_POS_BOTTOM, matrix);
+                renderer.setSprite(SPRITE_MINUS, 0, 2, matrix);
+            renderer.setSmallNumber(abs(outdoorWeather.temperature) + 0.5, TEXT_POS_BOTTOM, matrix);
             break;
         case MODE_EXT_HUMIDITY:
             DEBUG_SERIAL_PRINTLN(F("Outdoor humidity: ") + String(outdoorWeather.humidity) + F(" %rH"));
             renderer.clearScreenBuffer(matrix);
             if (outdoorWeather.humidity < 100)
-                renderer.setSmallText(String(outdoorWeather.humidity), TEXT_POS_TOP, matrix);
+                renderer.setSmallNumber(outdoorWeather.humidity, TEXT_POS_TOP, matrix);
             else
-            {
-                matrix[0] = 0b0010111011100000;
-                matrix[1] = 0b0110101010100000;
-                matrix[2] = 0b0010101010100000;
-                matrix[3] = 0b0010101010100000;
-                matrix[4] = 0b0010111011100000;
-            }
-            matrix[6] = 0b0100100000000000;
-            matrix[7] = 0b0001000000000000;
-            matrix[8] = 0b0010000000000000;
-            matrix[9] = 0b0100100000000000;
+                renderer.setSprite(SPRITE_HUNDRED, 1, 0, matrix);
+            renderer.setSprite(SPRITE_PERCENT, 1, 6, matrix);
             break;
 #endif
 
@@ -996,7 +961,7 @@ void loop()
         case MODE_TIMER:
             renderer.clearScreenBuffer(matrix);
             renderer.setSmallText("TI", TEXT_POS_TOP, matrix);
-            renderer.setSmallText(String(alarmTimer), TEXT_POS_BOTTOM, matrix);
+            renderer.setSmallNumber(alarmTimer, TEXT_POS_BOTTOM, matrix);
             break;
 #endif
 
@@ -1026,24 +991,9 @@ void loop()
             break;
 
         case MODE_FEED:
-            for (uint8_t y = 0; y <= 5; y++)
-            {
-                renderer.clearScreenBuffer(matrix);
-                for (uint8_t z = 0; z <= 6; z++)
-                {
-                    matrix[2 + z] |= (lettersBig[feedText[feedPosition] - 32][z] << (11 + y)) & 0b1111111111100000;
-                    matrix[2 + z] |= (lettersBig[feedText[feedPosition + 1] - 32][z] << (5 + y)) & 0b1111111111100000;
-                    matrix[2 + z] |= (lettersBig[feedText[feedPosition + 2] - 32][z] << (y - 1)) & 0b1111111111100000;
-                }
-                writeScreenBuffer(matrix, feedColor, brightness);
-                delay(120);
-            }
-            feedPosition++;
-            if (feedPosition == feedText.length() - 2)
-            {
-                feedPosition = 0;
+            renderer.clearScreenBuffer(matrix);
+            if (!feed.render(matrix))
                 setMode(MODE_TIME);
-            }
             break;
         }
 
@@ -1051,6 +1001,7 @@ void loop()
 #ifdef IR_LETTER_OFF
         renderer.unsetPixelInScreenBuffer(IR_LETTER_X, IR_LETTER_Y - 1, matrix);
 #endif
+        PROFILER_STOP(PROFILE_RENDER);
 
 #ifdef DEBUG_MATRIX
         // debugScreenBuffer(matrixOld);
@@ -1058,28 +1009,28 @@ void loop()
 #endif
 
 #ifdef DEBUG
-        struct tm tmNow = getTime();
         Serial.printf("Time (ESP): %02d:%02d:%02d %s, %s %02d. %02d \n", tmNow.tm_hour, tmNow.tm_min, tmNow.tm_sec, dayOfWeek[tmNow.tm_wday], monthOfYear[tmNow.tm_mon], tmNow.tm_mday, tmNow.tm_year + 1900);
         DEBUG_SERIAL_PRINTLN(F("Total Free Heap: ") + String(ESP.getFreeHeap() / 1024.0f) + F(" kB"));
 #endif
 
-        // write screenbuffer to display
+        // write screenbuffer to display (a running transition is replaced)
+        stopTransition();
         switch (mode)
         {
         case MODE_TIME:
         case MODE_BLANK:
-            if (settings.mySettings.transition == TRANSITION_NORMAL)
-                writeScreenBuffer(matrix, settings.mySettings.color, brightness);
-            if (settings.mySettings.transition == TRANSITION_FADE)
-                writeScreenBufferFade(matrixOld, matrix, settings.mySettings.color, brightness);
-            if (settings.mySettings.transition == TRANSITION_MOVEUP)
-            {
-                if (tmNow.tm_min % 5 == 0)
-                    moveScreenBufferUp(matrixOld, matrix, settings.mySettings.color, brightness);
-                else
-                    writeScreenBuffer(matrix, settings.mySettings.color, brightness);
-            }
+        {
+            // Move only every five minutes
+            uint8_t transition = settings.mySettings.transition;
+            if ((transition == TRANSITION_MOVEUP) && (tmNow.tm_min % 5 != 0))
+                transition = TRANSITION_NORMAL;
+#if defined(ENTRY_WORDS_COLOR) && !defined(FRONTCOVER_BINARY)
+            startTransition(transition, matrixOld, matrix, settings.mySettings.color, brightness, (mode == MODE_TIME) ? entryWordsColors : nullptr);
+#else
+            startTransition(transition, matrixOld, matrix, settings.mySettings.color, brightness);
+#endif
             break;
+        }
 #ifdef SHOW_MODE_TEST
         case MODE_RED:
             writeScreenBuffer(matrix, RED, brightness);
@@ -1095,18 +1046,12 @@ void loop()
             break;
 #endif
         case MODE_FEED:
-            writeScreenBuffer(matrix, feedColor, brightness);
+            writeScreenBuffer(matrix, feed.getColor(), brightness);
             break;
         default:
             if (runTransitionOnce)
             {
-                // if (settings.mySettings.transition == TRANSITION_NORMAL)
-                //     writeScreenBuffer(matrix, settings.mySettings.color, brightness);
-                // if (settings.mySettings.transition == TRANSITION_FADE)
-                //     writeScreenBufferFade(matrixOld, matrix, settings.mySettings.color, brightness);
-                // if (settings.mySettings.transition == TRANSITION_MOVEUP)
-                //     moveScreenBufferUp(matrixOld, matrix, settings.mySettings.color, brightness);
-                moveScreenBufferUp(matrixOld, matrix, settings.mySettings.color, brightness);
+                startTransition(TRANSITION_MOVEUP, matrixOld, matrix, settings.mySettings.color, brightness);
                 runTransitionOnce = false;
                 testColumn = 0;
             }
@@ -1122,141 +1067,51 @@ void loop()
         setMode(MODE_TIME);
     }
 
-#ifdef DEBUG_FPS
-    // debugFps();
-    fps++;
-#endif
+    // Do not sleep past the next step of the feed
+    if (mode == MODE_FEED)
+        scheduler.wakeUpAt(feed.getNextStep());
 }
 
 //=============================================================================
-// Transitions
+// Handle the gestures of the buttons and the IR remote control
 //=============================================================================
 
-void writeScreenBuffer(uint16_t screenBuffer[], uint8_t color, uint8_t brightness)
+void taskInput()
 {
-    ledDriver.clear();
-    for (uint8_t y = 0; y <= 9; y++)
-    {
-        for (uint8_t x = 0; x <= 10; x++)
-        {
-            if (bitRead(screenBuffer[y], 15 - x))
-            {
-                ledDriver.setPixel(x, y, color, brightness);
-            }
-        }
-    }
-
-    // Corner LEDs
-    for (uint8_t y = 0; y <= 3; y++)
-    {
-        if (bitRead(screenBuffer[y], 4))
-        {
-            ledDriver.setPixel(110 + y, color, brightness);
-        }
-    }
-
-    // Alarm LED
-#ifdef BUZZER
-    if (bitRead(screenBuffer[4], 4))
-    {
-#ifdef ALARM_LED_COLOR
-#ifdef ABUSE_CORNER_LED_FOR_ALARM
-        if (settings.mySettings.alarm1 || settings.mySettings.alarm2 || alarmTimerSet)
-        {
-            ledDriver.setPixel(111, ALARM_LED_COLOR, brightness);
-        }
-        else if (bitRead(screenBuffer[1], 4))
-        {
-            ledDriver.setPixel(111, color, brightness);
-        }
-#else
-        ledDriver.setPixel(114, ALARM_LED_COLOR, brightness);
-#endif
-#else
-        ledDriver.setPixel(114, color, brightness);
-#endif
-    }
-#endif
-
-    ledDriver.show();
+    input.handle();
 }
 
-void moveScreenBufferUp(uint16_t screenBufferOld[], uint16_t screenBufferNew[], uint8_t color, uint8_t brightness)
+void handleInput(eInputSource source, eInputGesture gesture)
 {
-    for (uint8_t z = 0; z <= 9; z++)
+    switch (gesture)
     {
-        for (uint8_t i = 0; i <= 8; i++)
-        {
-            screenBufferOld[i] = screenBufferOld[i + 1];
-        }
-        screenBufferOld[9] = screenBufferNew[z];
-        writeScreenBuffer(screenBufferOld, color, brightness);
-        delay(50);
-    }
-}
-
-void writeScreenBufferFade(uint16_t screenBufferOld[], uint16_t screenBufferNew[], uint8_t color, uint8_t brightness)
-{
-    ledDriver.clear();
-    uint8_t brightnessBuffer[10][12] = {};
-
-    // Copy old matrix to buffer
-    for (uint8_t y = 0; y <= 9; y++)
-    {
-        for (uint8_t x = 0; x <= 11; x++)
-        {
-            if (bitRead(screenBufferOld[y], 15 - x))
-            {
-                brightnessBuffer[y][x] = brightness;
-            }
-        }
-    }
-
-    // Fade old to new matrix
-    for (uint8_t i = 0; i < brightness; i++)
-    {
-        for (uint8_t y = 0; y <= 9; y++)
-        {
-            for (uint8_t x = 0; x <= 11; x++)
-            {
-                if (!(bitRead(screenBufferOld[y], 15 - x)) && (bitRead(screenBufferNew[y], 15 - x)))
-                {
-                    brightnessBuffer[y][x]++;
-                }
-                if ((bitRead(screenBufferOld[y], 15 - x)) && !(bitRead(screenBufferNew[y], 15 - x)))
-                {
-                    brightnessBuffer[y][x]--;
-                }
-                ledDriver.setPixel(x, y, color, brightnessBuffer[y][x]);
-            }
-        }
-
-        // Corner LEDs
-        for (uint8_t y = 0; y <= 3; y++)
-        {
-            ledDriver.setPixel(110 + y, color, brightnessBuffer[y][11]);
-        }
-
-        // Alarm LED
-#ifdef BUZZER
-#ifdef ALARM_LED_COLOR
-#ifdef ABUSE_CORNER_LED_FOR_ALARM
-        if (settings.mySettings.alarm1 || settings.mySettings.alarm2 || alarmTimerSet)
+    case INPUT_PRESS:
+        if (source == INPUT_ONOFF)
+            buttonOnOffPressed();
+        else if (source == INPUT_TIME)
+            buttonTimePressed();
+        else
+            buttonModePressed();
+        break;
+    case INPUT_LONG_PRESS:
+        // Back to the time from any mode
+        if ((source == INPUT_MODE) && (mode != MODE_BLANK))
         {
-            ledDriver.setPixel(111, ALARM_LED_COLOR, brightnessBuffer[4][11]);
+            DEBUG_SERIAL_PRINTLN(F("Mode held"));
+            modeTimeout = 0;
+            setMode(MODE_TIME);
         }
-        else
+        break;
+    case INPUT_DOUBLE_PRESS:
+#ifdef SHOW_MODE_DATE
+        // Date at a glance
+        if (source == INPUT_TIME)
         {
-            ledDriver.setPixel(111, color, brightnessBuffer[1][11]);
+            DEBUG_SERIAL_PRINTLN(F("Time pressed twice"));
+            setMode(MODE_DATE);
         }
-#else
-        ledDriver.setPixel(114, ALARM_LED_COLOR, brightnessBuffer[4][11]);
 #endif
-#else
-        ledDriver.setPixel(114, color, brightnessBuffer[4][11]);
-#endif
-#endif
-        ledDriver.show();
+        break;
     }
 }
 
@@ -1267,11 +1122,7 @@ void writeScreenBufferFade(uint16_t screenBufferOld[], uint16_t screenBufferNew[
 #ifdef ONOFF_BUTTON
 ICACHE_RAM_ATTR void buttonOnOffInterrupt()
 {
-    if (millis() > lastButtonPress + 250)
-    {
-        lastButtonPress = millis();
-        buttonOnOffPressed();
-    }
+    input.push(INPUT_ONOFF, digitalRead(PIN_ONOFF_BUTTON) == LOW);
 }
 #endif
 
@@ -1288,11 +1139,7 @@ void buttonOnOffPressed()
 #ifdef TIME_BUTTON
 ICACHE_RAM_ATTR void buttonTimeInterrupt()
 {
-    if (millis() > lastButtonPress + 250)
-    {
-        lastButtonPress = millis();
-        buttonTimePressed();
-    }
+    input.push(INPUT_TIME, digitalRead(PIN_TIME_BUTTON) == LOW);
 }
 #endif
 
@@ -1320,11 +1167,7 @@ void buttonTimePressed()
 #ifdef MODE_BUTTON
 ICACHE_RAM_ATTR void buttonModeInterrupt()
 {
-    if (millis() > lastButtonPress + 250)
-    {
-        lastButtonPress = millis();
-        buttonModePressed();
-    }
+    input.push(INPUT_MODE, digitalRead(PIN_MODE_BUTTON) == LOW);
 }
 #endif
 